@@ -8,3 +8,13 @@ if( USE_MPI )
     endif( MPI_FOUND )
     include(cmake/boost.cmake)
 endif( USE_MPI )
+
+option(USE_MPI_PROFILER OFF)
+if( USE_MPI_PROFILER )
+    if( WIN32 )
+        message( WARNING "MPI profiler is not supported on Windows" )
+        set( USE_MPI_PROFILER OFF )
+    else( WIN32 )
+        message( STATUS "Enable MPI profiler for MPI performance tests" )
+    endif( WIN32 )
+endif( USE_MPI_PROFILER )
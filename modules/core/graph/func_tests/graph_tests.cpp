@@ -0,0 +1,163 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "core/graph/include/task_graph.hpp"
+#include "core/task/include/task.hpp"
+#include "core/task/include/thread_pool.hpp"
+
+namespace {
+
+// Sums all inputs element-wise and scales the result
+class ScaleSumTask : public ppc::core::Task {
+ public:
+  ScaleSumTask(ppc::core::TaskDataPtr task_data, int32_t factor,
+               std::chrono::milliseconds delay = std::chrono::milliseconds(0))
+      : Task(std::move(task_data)), factor_(factor), delay_(delay) {}
+
+  bool ValidationImpl() override { return !task_data->inputs.empty() && task_data->outputs.size() == 1; }
+  bool PreProcessingImpl() override { return true; }
+
+  bool RunImpl() override {
+    std::this_thread::sleep_for(delay_);
+    auto output = task_data->GetOutput<int32_t>(0);
+    for (std::size_t i = 0; i < output.size(); i++) {
+      output[i] = 0;
+      for (std::size_t input = 0; input < task_data->inputs.size(); input++) {
+        output[i] += task_data->GetInput<int32_t>(input)[i];
+      }
+      output[i] *= factor_;
+    }
+    return true;
+  }
+
+  bool PostProcessingImpl() override { return true; }
+
+ private:
+  int32_t factor_;
+  std::chrono::milliseconds delay_;
+};
+
+class ThrowingTask : public ScaleSumTask {
+ public:
+  using ScaleSumTask::ScaleSumTask;
+  bool RunImpl() override { throw std::runtime_error("run failed"); }
+};
+
+ppc::core::TaskDataPtr MakeData(std::vector<int32_t> &out) {
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->AddOutput(out);
+  return task_data;
+}
+
+}  // namespace
+
+TEST(graph_tests, check_diamond) {
+  std::vector<int32_t> in = {1, 2, 3};
+  std::vector<int32_t> a_out(3);
+  std::vector<int32_t> b_out(3);
+  std::vector<int32_t> c_out(3);
+  std::vector<int32_t> d_out(3);
+
+  auto a_data = MakeData(a_out);
+  a_data->AddInput(in);
+
+  ppc::core::TaskGraph graph;
+  auto a = graph.AddNode(std::make_shared<ScaleSumTask>(a_data, 2));
+  auto b = graph.AddNode(std::make_shared<ScaleSumTask>(MakeData(b_out), 3));
+  auto c = graph.AddNode(std::make_shared<ScaleSumTask>(MakeData(c_out), 5));
+  auto d = graph.AddNode(std::make_shared<ScaleSumTask>(MakeData(d_out), 1));
+  graph.Connect(a, 0, b, 0);
+  graph.Connect(a, 0, c, 0);
+  graph.Connect(b, 0, d, 0);
+  graph.Connect(c, 0, d, 1);
+
+  // inputs view the producer outputs, nothing is copied
+  EXPECT_EQ(graph.GetTask(d)->GetData()->inputs[1], reinterpret_cast<uint8_t *>(c_out.data()));
+
+  ASSERT_TRUE(graph.Run(2));
+  EXPECT_EQ(d_out, std::vector<int32_t>({16, 32, 48}));
+  for (ppc::core::TaskGraph::NodeId id = 0; id < graph.Size(); id++) {
+    EXPECT_EQ(graph.State(id), ppc::core::TaskGraph::NodeState::kDone);
+  }
+
+  // the same graph runs again in a fixed order on one thread
+  in = {1, 1, 1};
+  ASSERT_TRUE(graph.Run(1));
+  EXPECT_EQ(d_out, std::vector<int32_t>({16, 16, 16}));
+}
+
+TEST(graph_tests, check_independent_nodes_run_concurrently) {
+  constexpr int kNodes = 4;
+  constexpr auto kDelay = std::chrono::milliseconds(50);
+  std::vector<int32_t> in = {1};
+  std::vector<std::vector<int32_t>> out(kNodes, std::vector<int32_t>(1));
+
+  ppc::core::TaskGraph graph;
+  for (auto &node_out : out) {
+    auto task_data = MakeData(node_out);
+    task_data->AddInput(in);
+    graph.AddNode(std::make_shared<ScaleSumTask>(task_data, 1, kDelay));
+  }
+
+  ppc::core::ThreadPool pool(kNodes);
+  const auto start = std::chrono::steady_clock::now();
+  ASSERT_TRUE(graph.Run(pool));
+  EXPECT_LT(std::chrono::steady_clock::now() - start, kDelay * kNodes * 3 / 4);
+}
+
+TEST(graph_tests, check_failures) {
+  std::vector<int32_t> in = {1};
+  std::vector<int32_t> a_out(1);
+  std::vector<int32_t> b_out(1);
+  std::vector<int32_t> c_out(1);
+  std::vector<int32_t> d_out(1);
+
+  // a has no input and fails validation, b depends on it, c is independent and d joins b and c
+  ppc::core::TaskGraph graph;
+  auto a = graph.AddNode(std::make_shared<ScaleSumTask>(MakeData(a_out), 1));
+  auto b = graph.AddNode(std::make_shared<ScaleSumTask>(MakeData(b_out), 1));
+  auto c_data = MakeData(c_out);
+  c_data->AddInput(in);
+  auto c = graph.AddNode(std::make_shared<ScaleSumTask>(c_data, 1));
+  graph.Connect(a, 0, b, 0);
+  auto d = graph.AddNode(std::make_shared<ScaleSumTask>(MakeData(d_out), 1));
+  graph.Connect(b, 0, d, 0);
+  graph.Connect(c, 0, d, 1);
+
+  EXPECT_THROW(graph.Connect(a, 1, b, 0), std::out_of_range);
+  EXPECT_THROW(graph.AddDependency(c, c), std::invalid_argument);
+  EXPECT_THROW(graph.Connect(c, 0, c, 0), std::invalid_argument);
+  // rejected connections add no dependencies, so b -> a does not close a cycle
+  EXPECT_THROW(graph.Connect(b, 0, a, 5), std::out_of_range);
+  EXPECT_EQ(graph.GetTask(b)->GetData()->inputs.size(), 1U);
+
+  EXPECT_FALSE(graph.Run(1));
+  EXPECT_EQ(graph.State(a), ppc::core::TaskGraph::NodeState::kFailed);
+  EXPECT_EQ(graph.State(b), ppc::core::TaskGraph::NodeState::kSkipped);
+  EXPECT_EQ(graph.State(c), ppc::core::TaskGraph::NodeState::kDone);
+  EXPECT_EQ(graph.State(d), ppc::core::TaskGraph::NodeState::kSkipped);
+
+  ppc::core::TaskGraph cycle;
+  auto x = cycle.AddNode(std::make_shared<ScaleSumTask>(MakeData(a_out), 1));
+  auto y = cycle.AddNode(std::make_shared<ScaleSumTask>(MakeData(b_out), 1));
+  cycle.AddDependency(x, y);
+  cycle.AddDependency(y, x);
+  EXPECT_THROW(cycle.Run(), std::invalid_argument);
+
+  ppc::core::TaskGraph throwing;
+  auto t_data = MakeData(a_out);
+  t_data->AddInput(in);
+  auto t = throwing.AddNode(std::make_shared<ThrowingTask>(t_data, 1));
+  auto u = throwing.AddNode(std::make_shared<ScaleSumTask>(MakeData(b_out), 1));
+  throwing.Connect(t, 0, u, 0);
+  EXPECT_THROW(throwing.Run(2), std::runtime_error);
+  EXPECT_EQ(throwing.State(u), ppc::core::TaskGraph::NodeState::kSkipped);
+}
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "core/task/include/task.hpp"
+#include "core/task/include/thread_pool.hpp"
+
+namespace ppc::core {
+
+// Directed acyclic graph of tasks. Connect makes an input of one task view an output buffer of another,
+// so results flow between stages without copies; Run executes the graph, independent nodes concurrently.
+//
+// Wiring is done per process: with MPI tasks a producer that leaves its result distributed (every process
+// fills its local part of the output) feeds the local input of the consumer, without gathering to rank 0
+// and scattering again. Run MPI graphs with one thread so every process enters collectives in the same
+// order; with one thread nodes run in a fixed topological order (ready nodes by id).
+class TaskGraph {
+ public:
+  using NodeId = std::size_t;
+
+  enum class NodeState : std::uint8_t { kPending, kDone, kFailed, kSkipped };
+
+  NodeId AddNode(std::shared_ptr<Task> task);
+
+  // input `input` of `to` views output `output` of `from`; the input is appended when `input` equals
+  // the current count of inputs of `to`. Output buffers must be allocated before Connect.
+  void Connect(NodeId from, std::size_t output, NodeId to, std::size_t input);
+  // `to` runs after `from` without sharing data
+  void AddDependency(NodeId from, NodeId to);
+
+  // Run the pipeline of every node once its dependencies succeeded. A node whose phase returns false
+  // fails and its dependents are skipped. Returns true if all nodes succeeded; rethrows the first
+  // exception of a node once running nodes have finished. Throws std::invalid_argument on a cycle.
+  // With threads > 1 up to `threads` nodes run at once on ThreadPool::Shared().
+  bool Run(std::size_t threads = 1);
+  // same on `pool` with up to `threads` nodes at once (0: the size of the pool)
+  bool Run(ThreadPool &pool, std::size_t threads = 0);
+
+  [[nodiscard]] std::size_t Size() const { return nodes_.size(); }
+  [[nodiscard]] NodeState State(NodeId id) const;
+  [[nodiscard]] const std::shared_ptr<Task> &GetTask(NodeId id) const;
+
+ private:
+  struct Node {
+    std::shared_ptr<Task> task;
+    std::vector<NodeId> dependents;
+    std::size_t dependencies = 0;
+    NodeState state = NodeState::kPending;
+  };
+
+  void CheckNode(NodeId id) const;
+  // node ids in the order Run starts them with one thread
+  [[nodiscard]] std::vector<NodeId> TopologicalOrder() const;
+  // pool == nullptr runs the nodes one by one on the calling thread
+  bool Execute(ThreadPool *pool, std::size_t threads);
+
+  std::vector<Node> nodes_;
+};
+
+}  // namespace ppc::core
@@ -0,0 +1,230 @@
+#include "core/graph/include/task_graph.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "core/task/include/task.hpp"
+#include "core/task/include/thread_pool.hpp"
+
+namespace {
+
+bool RunPipeline(ppc::core::Task &task) {
+  return task.Validation() && task.PreProcessing() && task.Run() && task.PostProcessing();
+}
+
+}  // namespace
+
+ppc::core::TaskGraph::NodeId ppc::core::TaskGraph::AddNode(std::shared_ptr<Task> task) {
+  if (!task) {
+    throw std::invalid_argument("TaskGraph: task is null");
+  }
+  nodes_.emplace_back().task = std::move(task);
+  return nodes_.size() - 1;
+}
+
+void ppc::core::TaskGraph::Connect(NodeId from, std::size_t output, NodeId to, std::size_t input) {
+  CheckNode(from);
+  CheckNode(to);
+  const auto &src = *nodes_[from].task->GetData();
+  auto &dst = *nodes_[to].task->GetData();
+  if (output >= src.outputs.size()) {
+    throw std::out_of_range("TaskGraph: node " + std::to_string(from) + " has no output " + std::to_string(output));
+  }
+  if (input > dst.inputs.size()) {
+    throw std::out_of_range("TaskGraph: node " + std::to_string(to) + " has no input " + std::to_string(input));
+  }
+  const auto info = output < src.outputs_info.size() ? src.outputs_info[output] : BufferInfo();
+  if (input < dst.inputs_info.size() && dst.inputs_info[input].type != nullptr && info.type != nullptr &&
+      *dst.inputs_info[input].type != *info.type) {
+    throw std::invalid_argument("TaskGraph: output " + std::to_string(output) + " of node " + std::to_string(from) +
+                                " does not match the type of input " + std::to_string(input) + " of node " +
+                                std::to_string(to));
+  }
+
+  // the graph is left untouched if any check fails
+  AddDependency(from, to);
+  if (input == dst.inputs.size()) {
+    dst.inputs.push_back(src.outputs[output]);
+    dst.inputs_count.push_back(src.outputs_count[output]);
+  } else {
+    dst.inputs[input] = src.outputs[output];
+    dst.inputs_count[input] = src.outputs_count[output];
+  }
+  if (info.type != nullptr || input < dst.inputs_info.size()) {
+    dst.inputs_info.resize(std::max(dst.inputs_info.size(), input + 1));
+    dst.inputs_info[input] = info;
+  }
+}
+
+void ppc::core::TaskGraph::AddDependency(NodeId from, NodeId to) {
+  CheckNode(from);
+  CheckNode(to);
+  if (from == to) {
+    throw std::invalid_argument("TaskGraph: node " + std::to_string(from) + " cannot depend on itself");
+  }
+  nodes_[from].dependents.push_back(to);
+  nodes_[to].dependencies++;
+}
+
+ppc::core::TaskGraph::NodeState ppc::core::TaskGraph::State(NodeId id) const {
+  CheckNode(id);
+  return nodes_[id].state;
+}
+
+const std::shared_ptr<ppc::core::Task> &ppc::core::TaskGraph::GetTask(NodeId id) const {
+  CheckNode(id);
+  return nodes_[id].task;
+}
+
+void ppc::core::TaskGraph::CheckNode(NodeId id) const {
+  if (id >= nodes_.size()) {
+    throw std::out_of_range("TaskGraph: node " + std::to_string(id) + " does not exist");
+  }
+}
+
+std::vector<ppc::core::TaskGraph::NodeId> ppc::core::TaskGraph::TopologicalOrder() const {
+  std::vector<std::size_t> remaining(nodes_.size());
+  std::priority_queue<NodeId, std::vector<NodeId>, std::greater<>> ready;
+  for (NodeId id = 0; id < nodes_.size(); id++) {
+    remaining[id] = nodes_[id].dependencies;
+    if (remaining[id] == 0) {
+      ready.push(id);
+    }
+  }
+  std::vector<NodeId> order;
+  order.reserve(nodes_.size());
+  while (!ready.empty()) {
+    const auto id = ready.top();
+    ready.pop();
+    order.push_back(id);
+    for (auto dependent : nodes_[id].dependents) {
+      if (--remaining[dependent] == 0) {
+        ready.push(dependent);
+      }
+    }
+  }
+  if (order.size() != nodes_.size()) {
+    throw std::invalid_argument("TaskGraph: dependencies form a cycle");
+  }
+  return order;
+}
+
+bool ppc::core::TaskGraph::Run(std::size_t threads) {
+  return threads <= 1 ? Execute(nullptr, 1) : Execute(&ThreadPool::Shared(), threads);
+}
+
+bool ppc::core::TaskGraph::Run(ThreadPool &pool, std::size_t threads) {
+  return Execute(&pool, threads == 0 ? static_cast<std::size_t>(pool.Size()) : threads);
+}
+
+bool ppc::core::TaskGraph::Execute(ThreadPool *pool, std::size_t threads) {
+  const auto order = TopologicalOrder();
+  for (auto &node : nodes_) {
+    node.state = NodeState::kPending;
+  }
+
+  std::mutex mutex;
+  std::deque<NodeId> ready;
+  std::vector<std::size_t> remaining(nodes_.size());
+  // a dependency of the node failed or was skipped
+  std::vector<bool> blocked(nodes_.size(), false);
+  std::exception_ptr error;
+
+  for (NodeId id = 0; id < nodes_.size(); id++) {
+    remaining[id] = nodes_[id].dependencies;
+  }
+  // called under the lock once a node has its final state
+  std::function<void(NodeId)> complete = [&](NodeId id) {
+    const bool ok = nodes_[id].state == NodeState::kDone;
+    for (auto dependent : nodes_[id].dependents) {
+      blocked[dependent] = blocked[dependent] || !ok;
+      if (--remaining[dependent] != 0) {
+        continue;
+      }
+      if (blocked[dependent]) {
+        nodes_[dependent].state = NodeState::kSkipped;
+        complete(dependent);
+      } else {
+        ready.push_back(dependent);
+      }
+    }
+  };
+  auto execute = [&](NodeId id) {
+    bool ok = false;
+    try {
+      ok = RunPipeline(*nodes_[id].task);
+    } catch (...) {
+      const std::lock_guard lock(mutex);
+      if (!error) {
+        error = std::current_exception();
+      }
+    }
+    const std::lock_guard lock(mutex);
+    nodes_[id].state = ok ? NodeState::kDone : NodeState::kFailed;
+    complete(id);
+  };
+
+  if (pool == nullptr) {
+    for (auto id : order) {
+      // nodes behind a failed or skipped dependency were already completed as skipped by complete()
+      if (nodes_[id].state != NodeState::kPending) {
+        continue;
+      }
+      if (error) {
+        const std::lock_guard lock(mutex);
+        nodes_[id].state = NodeState::kSkipped;
+        complete(id);
+      } else {
+        execute(id);
+      }
+    }
+  } else {
+    ThreadPool::Group group;
+    std::size_t running = 0;
+    // called under the lock: start ready nodes while fewer than `threads` run
+    std::function<void()> dispatch = [&] {
+      while (!ready.empty() && (error || running < threads)) {
+        const auto id = ready.front();
+        ready.pop_front();
+        if (error) {
+          // after an exception no new nodes are started
+          nodes_[id].state = NodeState::kSkipped;
+          complete(id);
+          continue;
+        }
+        running++;
+        pool->Submit(group, [&, id] {
+          execute(id);
+          const std::lock_guard lock(mutex);
+          running--;
+          dispatch();
+        });
+      }
+    };
+    {
+      const std::lock_guard lock(mutex);
+      for (auto id : order) {
+        if (nodes_[id].dependencies == 0) {
+          ready.push_back(id);
+        }
+      }
+      dispatch();
+    }
+    pool->Wait(group);
+  }
+
+  if (error) {
+    std::rethrow_exception(error);
+  }
+  return std::ranges::all_of(nodes_, [](const Node &node) { return node.state == NodeState::kDone; });
+}
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <algorithm>
+#include <boost/mpi/collectives/broadcast.hpp>
+#include <boost/mpi/collectives/scatterv.hpp>
+#include <boost/mpi/communicator.hpp>
+#include <cstddef>
+#include <span>
+#include <vector>
+
+#include "core/task/include/batch.hpp"
+
+namespace ppc::core::mpi {
+
+// Part of a packed batch owned by one process. The packed values are split into equal contiguous chunks
+// regardless of item boundaries, so a process may hold the tail of one item and the head of the next.
+template <class T>
+struct BatchChunk {
+  std::vector<T> values;
+  // position of values[0] in the packed batch
+  std::size_t begin = 0;
+  // item boundaries of the whole batch, the same on every process
+  std::vector<std::size_t> offsets;
+
+  [[nodiscard]] std::size_t Items() const { return offsets.empty() ? 0 : offsets.size() - 1; }
+
+  // call fn(item, values) for every item that overlaps the chunk, with the overlapping values
+  template <class Fn>
+  void ForEachItem(Fn &&fn) const {
+    const std::size_t end = begin + values.size();
+    auto first = std::upper_bound(offsets.begin(), offsets.end(), begin);
+    for (auto item = static_cast<std::size_t>(first - offsets.begin()) - 1; item < Items(); item++) {
+      if (offsets[item] >= end) {
+        break;
+      }
+      const auto lo = std::max(offsets[item], begin);
+      const auto hi = std::min(offsets[item + 1], end);
+      fn(item, std::span<const T>(values).subspan(lo - begin, hi - lo));
+    }
+  }
+};
+
+// Distribute the batch packed on `root` with one broadcast of the item boundaries and one scatterv of the
+// values, instead of a collective per item. `packed` is read on the root only.
+template <class T>
+BatchChunk<T> ScatterBatch(const boost::mpi::communicator &comm, const PackedBatch<T> &packed, int root = 0) {
+  BatchChunk<T> chunk;
+  std::size_t boundaries = packed.offsets.size();
+  boost::mpi::broadcast(comm, boundaries, root);
+  chunk.offsets = comm.rank() == root ? packed.offsets : std::vector<std::size_t>(boundaries);
+  boost::mpi::broadcast(comm, chunk.offsets.data(), static_cast<int>(boundaries), root);
+
+  const auto size = static_cast<std::size_t>(comm.size());
+  const std::size_t total = chunk.offsets.back();
+  std::vector<int> counts(size);
+  std::vector<int> displs(size);
+  for (std::size_t i = 0; i < size; i++) {
+    const std::size_t lo = total * i / size;
+    const std::size_t hi = total * (i + 1) / size;
+    counts[i] = static_cast<int>(hi - lo);
+    displs[i] = static_cast<int>(lo);
+  }
+  const auto rank = static_cast<std::size_t>(comm.rank());
+  chunk.begin = static_cast<std::size_t>(displs[rank]);
+  chunk.values.resize(counts[rank]);
+  boost::mpi::scatterv(comm, packed.values.data(), counts, displs, chunk.values.data(), counts[rank], root);
+  return chunk;
+}
+
+}  // namespace ppc::core::mpi
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <boost/mpi/communicator.hpp>
+
+namespace ppc::core::mpi {
+
+namespace detail {
+
+inline boost::mpi::communicator &CurrentComm() {
+  static boost::mpi::communicator comm;
+  return comm;
+}
+
+}  // namespace detail
+
+// Communicator of the running test. The test runners give every test a fresh duplicate of MPI_COMM_WORLD, so
+// a message left behind by one test cannot be received by the next one; outside of a test it is the world.
+// Tasks take it on construction: `boost::mpi::communicator world_ = ppc::core::mpi::Comm();`
+inline boost::mpi::communicator Comm() { return detail::CurrentComm(); }
+
+// Makes Comm() a duplicate of `parent` until the object is destroyed. Both are collective over `parent`.
+class ScopedComm {
+ public:
+  explicit ScopedComm(const boost::mpi::communicator &parent) : previous_(detail::CurrentComm()) {
+    detail::CurrentComm() = boost::mpi::communicator(parent, boost::mpi::comm_duplicate);
+  }
+  ScopedComm(const ScopedComm &) = delete;
+  ScopedComm &operator=(const ScopedComm &) = delete;
+  ScopedComm(ScopedComm &&) = delete;
+  ScopedComm &operator=(ScopedComm &&) = delete;
+  ~ScopedComm() { detail::CurrentComm() = previous_; }
+
+ private:
+  boost::mpi::communicator previous_;
+};
+
+}  // namespace ppc::core::mpi
@@ -0,0 +1,139 @@
+#pragma once
+
+#include <boost/mpi/collectives/gatherv.hpp>
+#include <boost/mpi/collectives/scatterv.hpp>
+#include <boost/mpi/communicator.hpp>
+#include <boost/mpi/nonblocking.hpp>
+#include <boost/mpi/request.hpp>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "core/task/include/partition.hpp"
+#include "core/task/include/task.hpp"
+
+namespace ppc::core::mpi {
+
+// Local part of a buffer distributed across the processes of a communicator. Passing it between tasks
+// with TaskData::AddDistributedInput/AddDistributedOutput keeps the data on the processes; only
+// Materialize moves it to one process.
+template <class T>
+struct DistributedBuffer {
+  std::shared_ptr<const Partition> partition;
+  std::vector<T> local;
+
+  DistributedBuffer() = default;
+  DistributedBuffer(const boost::mpi::communicator &comm, std::shared_ptr<const Partition> layout)
+      : partition(std::move(layout)), local(partition->Count(comm.rank())) {
+    if (partition->Parts() != comm.size()) {
+      throw std::invalid_argument("DistributedBuffer: partition does not match the communicator size");
+    }
+  }
+
+  void AddAsInput(TaskData &task_data, const boost::mpi::communicator &comm) {
+    task_data.AddDistributedInput(local.data(), partition, comm.rank());
+  }
+  void AddAsOutput(TaskData &task_data, const boost::mpi::communicator &comm) {
+    task_data.AddDistributedOutput(local.data(), partition, comm.rank());
+  }
+};
+
+namespace detail {
+
+inline void MpiLayout(const Partition &partition, std::vector<int> &counts, std::vector<int> &displs) {
+  counts.resize(partition.Parts());
+  displs.resize(partition.Parts());
+  for (int p = 0; p < partition.Parts(); p++) {
+    counts[p] = static_cast<int>(partition.Count(p));
+    displs[p] = static_cast<int>(partition.Offset(p));
+  }
+}
+
+}  // namespace detail
+
+// Split a buffer held by `root` according to the partition (global is read on the root only)
+template <class T>
+DistributedBuffer<T> Distribute(const boost::mpi::communicator &comm, std::span<const T> global,
+                                std::shared_ptr<const Partition> partition, int root = 0) {
+  DistributedBuffer<T> buffer(comm, std::move(partition));
+  std::vector<int> counts;
+  std::vector<int> displs;
+  detail::MpiLayout(*buffer.partition, counts, displs);
+  boost::mpi::scatterv(comm, global.data(), counts, displs, buffer.local.data(), counts[comm.rank()], root);
+  return buffer;
+}
+
+// Gather a distributed buffer to `root`; the other processes get an empty vector
+template <class T>
+std::vector<T> Materialize(const boost::mpi::communicator &comm, std::span<const T> local, const Partition &partition,
+                           int root = 0) {
+  std::vector<int> counts;
+  std::vector<int> displs;
+  detail::MpiLayout(partition, counts, displs);
+  std::vector<T> global(comm.rank() == root ? partition.GlobalCount() : 0);
+  if (comm.rank() == root) {
+    boost::mpi::gatherv(comm, local.data(), static_cast<int>(local.size()), global.data(), counts, displs, root);
+  } else {
+    boost::mpi::gatherv(comm, local.data(), static_cast<int>(local.size()), root);
+  }
+  return global;
+}
+
+template <class T>
+std::vector<T> Materialize(const boost::mpi::communicator &comm, const DistributedBuffer<T> &buffer, int root = 0) {
+  return Materialize(comm, std::span<const T>(buffer.local), *buffer.partition, root);
+}
+
+// Rows adjacent to the local rows of a row-partitioned buffer, received from the processes that own them:
+// `above` is the row before the first local row, `below` the row after the last one. Both are empty at the
+// global edges and on processes without rows.
+template <class T>
+struct HaloRows {
+  std::vector<T> above;
+  std::vector<T> below;
+};
+
+template <class T>
+HaloRows<T> ExchangeHaloRows(const boost::mpi::communicator &comm, std::span<const T> local,
+                             const Partition &partition) {
+  constexpr int kTagAbove = 0;
+  constexpr int kTagBelow = 1;
+  const auto row_size = static_cast<int>(partition.RowSize());
+  const int rank = comm.rank();
+  HaloRows<T> halo;
+  std::vector<boost::mpi::request> requests;
+
+  auto last_row = [&](int part) { return partition.FirstRow(part) + partition.Rows(part) - 1; };
+  if (partition.Rows(rank) > 0) {
+    if (partition.FirstRow(rank) > 0) {
+      halo.above.resize(row_size);
+      requests.push_back(
+          comm.irecv(partition.RowOwner(partition.FirstRow(rank) - 1), kTagAbove, halo.above.data(), row_size));
+    }
+    if (last_row(rank) + 1 < partition.Rows()) {
+      halo.below.resize(row_size);
+      requests.push_back(comm.irecv(partition.RowOwner(last_row(rank) + 1), kTagBelow, halo.below.data(), row_size));
+    }
+  }
+  // send the rows this process owns to the processes whose blocks end right before or start right after them
+  for (int part = 0; part < partition.Parts(); part++) {
+    if (part == rank || partition.Rows(part) == 0) {
+      continue;
+    }
+    const auto first = partition.FirstRow(part);
+    if (first > 0 && partition.RowOwner(first - 1) == rank) {
+      const auto offset = (first - 1 - partition.FirstRow(rank)) * partition.RowSize();
+      requests.push_back(comm.isend(part, kTagAbove, local.data() + offset, row_size));
+    }
+    if (last_row(part) + 1 < partition.Rows() && partition.RowOwner(last_row(part) + 1) == rank) {
+      const auto offset = (last_row(part) + 1 - partition.FirstRow(rank)) * partition.RowSize();
+      requests.push_back(comm.isend(part, kTagBelow, local.data() + offset, row_size));
+    }
+  }
+  boost::mpi::wait_all(requests.begin(), requests.end());
+  return halo;
+}
+
+}  // namespace ppc::core::mpi
@@ -0,0 +1,100 @@
+#pragma once
+
+#include <algorithm>
+#include <boost/mpi/collectives/all_reduce.hpp>
+#include <boost/mpi/communicator.hpp>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "core/mpi/include/comm_mpi.hpp"
+#include "core/task/include/partition.hpp"
+#include "core/task/include/thread_pool.hpp"
+#include "core/util/include/thread_config.hpp"
+#include "oneapi/tbb/task_arena.h"
+
+namespace ppc::core::mpi {
+
+// Per-process state of hybrid MPI + threads tasks: the communicator of the test, the shared thread pool and
+// a TBB arena, both sized by ppc::util::GetThreadConfig(). Created on first use and kept until exit, so
+// tasks do not start threads on every Run. Only the calling thread communicates, so MPI_THREAD_FUNNELED
+// is enough.
+class HybridContext {
+ public:
+  static HybridContext &Get() {
+    static HybridContext context;
+    return context;
+  }
+
+  HybridContext(const HybridContext &) = delete;
+  HybridContext &operator=(const HybridContext &) = delete;
+  HybridContext(HybridContext &&) = delete;
+  HybridContext &operator=(HybridContext &&) = delete;
+  ~HybridContext() = default;
+
+  [[nodiscard]] boost::mpi::communicator Comm() const { return ppc::core::mpi::Comm(); }
+  [[nodiscard]] int Threads() const { return pool_.Size(); }
+  ThreadPool &Pool() { return pool_; }
+  oneapi::tbb::task_arena &Arena() { return arena_; }
+
+  // part [begin, end) of a global range [0, count) that belongs to this process
+  [[nodiscard]] std::pair<std::size_t, std::size_t> LocalRange(std::size_t count) const {
+    const auto comm = Comm();
+    const auto partition = Partition::Block(count, comm.size());
+    const auto begin = static_cast<std::size_t>(partition.Offset(comm.rank()));
+    return {begin, begin + static_cast<std::size_t>(partition.Count(comm.rank()))};
+  }
+
+  // call fn(i) for the indices of [0, count) owned by this process, split between its threads;
+  // every process must call it with the same count
+  template <class Fn>
+  void ParallelFor(std::size_t count, Fn &&fn) {
+    const auto [begin, end] = LocalRange(count);
+    pool_.ParallelFor(begin, end, [&](std::size_t chunk_begin, std::size_t chunk_end) {
+      for (auto i = chunk_begin; i < chunk_end; i++) {
+        fn(i);
+      }
+    });
+  }
+
+  // combine(..., map(i)) over [0, count) on all processes: the range of a process is cut into fixed chunks
+  // reduced by the pool threads, the chunks are combined in order and the processes all-reduce the results,
+  // so the result does not depend on scheduling. `combine` must be associative; every process gets it.
+  template <class T, class Map, class Combine>
+  T ParallelReduce(std::size_t count, T identity, Map &&map, Combine combine) {
+    static_assert(!std::is_same_v<T, bool>, "threads write the partial results of std::vector<bool> concurrently");
+    const auto [begin, end] = LocalRange(count);
+    const auto chunks = std::min<std::size_t>(end - begin, static_cast<std::size_t>(pool_.Size()) * kChunksPerThread);
+    std::vector<T> partials(chunks, identity);
+    auto reduce_chunk = [&](std::size_t chunk) {
+      const auto chunk_end = begin + ((end - begin) * (chunk + 1) / chunks);
+      for (auto i = begin + ((end - begin) * chunk / chunks); i < chunk_end; i++) {
+        partials[chunk] = combine(partials[chunk], map(i));
+      }
+    };
+    pool_.ParallelFor(
+        0, chunks,
+        [&](std::size_t first_chunk, std::size_t last_chunk) {
+          for (auto chunk = first_chunk; chunk < last_chunk; chunk++) {
+            reduce_chunk(chunk);
+          }
+        },
+        1);
+    T local = identity;
+    for (const auto &partial : partials) {
+      local = combine(local, partial);
+    }
+    return boost::mpi::all_reduce(Comm(), local, combine);
+  }
+
+ private:
+  static constexpr std::size_t kChunksPerThread = 4;
+
+  HybridContext() : pool_(ThreadPool::Shared()), arena_(std::max(ppc::util::GetThreadConfig().num_threads, 1)) {}
+
+  ThreadPool &pool_;
+  oneapi::tbb::task_arena arena_;
+};
+
+}  // namespace ppc::core::mpi
@@ -0,0 +1,22 @@
+#pragma once
+
+#include <boost/mpi/collectives/all_gather.hpp>
+#include <boost/mpi/communicator.hpp>
+#include <vector>
+
+#include "core/perf/include/perf.hpp"
+
+namespace ppc::core::mpi {
+
+// Make perf measurement cover all processes of the communicator: the measurement starts after a barrier and
+// PerfResults::ranks receives the elapsed time of every process, so stragglers show up on rank 0
+inline void SetMultiRankTiming(PerfAttr &perf_attr, const boost::mpi::communicator &comm) {
+  perf_attr.barrier = [comm] { comm.barrier(); };
+  perf_attr.gather_times = [comm](double local_time) {
+    std::vector<double> times;
+    boost::mpi::all_gather(comm, local_time, times);
+    return times;
+  };
+}
+
+}  // namespace ppc::core::mpi
@@ -1,13 +1,22 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <chrono>
 #include <cstdint>
+#include <iostream>
 #include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
 #include <vector>
 
 #include "core/perf/func_tests/test_task.hpp"
+#include "core/perf/include/hw_counters.hpp"
 #include "core/perf/include/perf.hpp"
+#include "core/perf/include/perf_record.hpp"
+#include "core/perf/include/sweep.hpp"
 #include "core/task/include/task.hpp"
+#include "core/util/include/budget.hpp"
 
 TEST(perf_tests, check_perf_pipeline) {
   // Create data
@@ -175,3 +184,253 @@ TEST(perf_tests, check_perf_task_float) {
   ASSERT_LE(perf_results->time_sec, ppc::core::PerfResults::kMaxTime);
   EXPECT_EQ(out[0], in.size());
 }
+
+TEST(perf_tests, check_perf_samples_with_warmup) {
+  // Create data
+  std::vector<uint32_t> in(2000, 1);
+  std::vector<uint32_t> out(1, 0);
+
+  // Create task_data
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
+  task_data->inputs_count.emplace_back(in.size());
+  task_data->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+  task_data->outputs_count.emplace_back(out.size());
+
+  // Create Task
+  auto test_task = std::make_shared<ppc::test::perf::TestTask<uint32_t>>(task_data);
+
+  // Create Perf attributes: every timer call advances the clock by one second
+  auto perf_attr = std::make_shared<ppc::core::PerfAttr>();
+  perf_attr->num_running = 10;
+  perf_attr->num_warmup = 3;
+  int timer_calls = 0;
+  perf_attr->current_timer = [&] { return static_cast<double>(timer_calls++); };
+
+  // Create and init perf results
+  auto perf_results = std::make_shared<ppc::core::PerfResults>();
+
+  // Create Perf analyzer
+  ppc::core::Perf perf_analyzer(test_task);
+  perf_analyzer.PipelineRun(perf_attr, perf_results);
+
+  // warmup runs are not timed
+  EXPECT_EQ(timer_calls, 11);
+  ASSERT_EQ(perf_results->samples.size(), 10U);
+  EXPECT_DOUBLE_EQ(perf_results->time_sec, 10.0);
+  EXPECT_EQ(perf_results->stats.count, 10U);
+  EXPECT_DOUBLE_EQ(perf_results->stats.median, 1.0);
+  EXPECT_DOUBLE_EQ(perf_results->stats.stddev, 0.0);
+  EXPECT_EQ(out[0], in.size());
+}
+
+TEST(perf_tests, check_perf_statistics) {
+  auto stats = ppc::core::ComputePerfStatistics({5.0, 1.0, 4.0, 2.0, 3.0});
+
+  EXPECT_EQ(stats.count, 5U);
+  EXPECT_DOUBLE_EQ(stats.min, 1.0);
+  EXPECT_DOUBLE_EQ(stats.max, 5.0);
+  EXPECT_DOUBLE_EQ(stats.mean, 3.0);
+  EXPECT_DOUBLE_EQ(stats.median, 3.0);
+  EXPECT_DOUBLE_EQ(stats.p95, 4.8);
+  EXPECT_NEAR(stats.stddev, 1.5811388, 1e-6);
+  EXPECT_LT(stats.ci_low, stats.mean);
+  EXPECT_GT(stats.ci_high, stats.mean);
+}
+
+TEST(perf_tests, check_perf_significant_regression) {
+  auto baseline = ppc::core::ComputePerfStatistics({1.00, 1.01, 0.99, 1.02, 0.98, 1.00});
+  auto noisy = ppc::core::ComputePerfStatistics({1.01, 0.98, 1.02, 1.00, 0.99, 1.01});
+  auto slower = ppc::core::ComputePerfStatistics({1.20, 1.21, 1.19, 1.22, 1.18, 1.20});
+
+  EXPECT_FALSE(ppc::core::IsSignificantlySlower(baseline, noisy));
+  EXPECT_TRUE(ppc::core::IsSignificantlySlower(baseline, slower));
+  EXPECT_FALSE(ppc::core::IsSignificantlySlower(slower, baseline));
+}
+
+TEST(perf_tests, check_perf_record) {
+  auto perf_results = std::make_shared<ppc::core::PerfResults>();
+  perf_results->type_of_running = ppc::core::PerfResults::kPipeline;
+  perf_results->samples = {0.5, 0.25};
+  perf_results->stats = ppc::core::ComputePerfStatistics(perf_results->samples);
+  perf_results->time_sec = 0.75;
+  perf_results->input_size = 2000;
+
+  auto record =
+      ppc::core::MakePerfRecord(*perf_results, "/home/user/ppc/tasks/mpi/example/perf_tests/main.cpp", "test_run");
+  EXPECT_EQ(record.task, "example");
+  EXPECT_EQ(record.technology, "mpi");
+  EXPECT_EQ(record.type_of_running, "pipeline");
+  EXPECT_EQ(record.input_size, 2000U);
+
+  std::ostringstream json;
+  ppc::core::WritePerfRecord(json, record, ppc::core::PerfOutputFormat::kJson);
+  EXPECT_NE(json.str().find(R"("task":"example","technology":"mpi","test":"test_run")"), std::string::npos);
+  EXPECT_NE(json.str().find(R"("samples":[0.5,0.25])"), std::string::npos);
+  EXPECT_EQ(json.str().back(), '\n');
+
+  std::ostringstream csv;
+  ppc::core::WritePerfRecord(csv, record, ppc::core::PerfOutputFormat::kCsv);
+  EXPECT_EQ(csv.str().rfind("example,mpi,test_run,pipeline,", 0), 0U);
+  EXPECT_NE(csv.str().find(",0.5;0.25,"), std::string::npos);
+}
+
+TEST(perf_tests, check_perf_gathered_rank_times) {
+  // Create data
+  std::vector<uint32_t> in(2000, 1);
+  std::vector<uint32_t> out(1, 0);
+
+  // Create task_data
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
+  task_data->inputs_count.emplace_back(in.size());
+  task_data->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+  task_data->outputs_count.emplace_back(out.size());
+
+  // Create Task
+  auto test_task = std::make_shared<ppc::test::perf::TestTask<uint32_t>>(task_data);
+
+  // Create Perf attributes: emulate four processes where the last one is a straggler
+  auto perf_attr = std::make_shared<ppc::core::PerfAttr>();
+  perf_attr->num_running = 10;
+  int barrier_calls = 0;
+  perf_attr->barrier = [&] { barrier_calls++; };
+  perf_attr->gather_times = [](double local_time) { return std::vector<double>{local_time, 1.0, 1.0, 5.0}; };
+
+  // Create and init perf results
+  auto perf_results = std::make_shared<ppc::core::PerfResults>();
+
+  // Create Perf analyzer
+  ppc::core::Perf perf_analyzer(test_task);
+  perf_analyzer.PipelineRun(perf_attr, perf_results);
+
+  EXPECT_EQ(barrier_calls, 1);
+  ASSERT_EQ(perf_results->ranks.times.size(), 4U);
+  EXPECT_DOUBLE_EQ(perf_results->ranks.max, 5.0);
+  EXPECT_DOUBLE_EQ(perf_results->ranks.min, 0.0);
+  EXPECT_DOUBLE_EQ(perf_results->ranks.mean, 1.75);
+  EXPECT_NEAR(perf_results->ranks.imbalance, 5.0 / 1.75, 1e-12);
+  EXPECT_DOUBLE_EQ(perf_results->time_sec, 5.0);
+
+  auto record = ppc::core::MakePerfRecord(*perf_results, "tasks/mpi/example/perf_tests/main.cpp", "test_run");
+  EXPECT_EQ(record.processes, 4);
+}
+
+TEST(perf_tests, check_perf_parse_hw_events) {
+  auto events = ppc::core::ParseHwEvents("cycles,instructions,,dtlb_misses");
+  ASSERT_EQ(events.size(), 3U);
+  EXPECT_EQ(events[0], ppc::core::HwEvent::kCycles);
+  EXPECT_EQ(events[1], ppc::core::HwEvent::kInstructions);
+  EXPECT_EQ(events[2], ppc::core::HwEvent::kDtlbMisses);
+  EXPECT_STREQ(ppc::core::HwEventName(ppc::core::HwEvent::kLlcMisses), "llc_misses");
+  EXPECT_TRUE(ppc::core::ParseHwEvents("").empty());
+  EXPECT_THROW(ppc::core::ParseHwEvents("cycles,flops"), std::invalid_argument);
+}
+
+TEST(perf_tests, check_perf_hw_counters) {
+  // Create data
+  std::vector<uint32_t> in(2000, 1);
+  std::vector<uint32_t> out(1, 0);
+
+  // Create task_data
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->AddInput(in);
+  task_data->AddOutput(out);
+
+  // Create Task
+  auto test_task = std::make_shared<ppc::test::perf::TestTask<uint32_t>>(task_data);
+
+  // Create Perf attributes
+  auto perf_attr = std::make_shared<ppc::core::PerfAttr>();
+  perf_attr->num_running = 10;
+  perf_attr->hw_events = {ppc::core::HwEvent::kCycles, ppc::core::HwEvent::kInstructions};
+
+  // Create and init perf results
+  auto perf_results = std::make_shared<ppc::core::PerfResults>();
+
+  // Counters may be unavailable (virtual machines, perf_event_paranoid): the run must not fail then
+  ppc::core::Perf perf_analyzer(test_task);
+  perf_analyzer.TaskRun(perf_attr, perf_results);
+  ASSERT_LE(perf_results->hw_counters.size(), 2U);
+  for (const auto &count : perf_results->hw_counters) {
+    EXPECT_GT(count.value, 0U);
+  }
+}
+
+TEST(perf_tests, check_perf_sweep) {
+  auto factory = [](uint64_t size) {
+    auto in = std::make_shared<std::vector<uint32_t>>(size, 1);
+    auto out = std::make_shared<std::vector<uint32_t>>(1, 0);
+    auto task_data = std::make_shared<ppc::core::TaskData>();
+    task_data->AddInput(in);
+    task_data->AddOutput(out);
+    auto buffers = std::make_shared<std::vector<std::shared_ptr<std::vector<uint32_t>>>>(
+        std::vector<std::shared_ptr<std::vector<uint32_t>>>{in, out});
+    return ppc::core::SweepCase{.task = std::make_shared<ppc::test::perf::TestTask<uint32_t>>(task_data),
+                                .data = buffers};
+  };
+
+  ppc::core::SweepConfig config;
+  config.sizes = {1000, 4000};
+  config.threads = {1, 2};
+  std::vector<int> applied_threads;
+  config.set_threads = [&](int threads) { applied_threads.push_back(threads); };
+  config.get_threads = [] { return 3; };
+  config.perf_attr.num_running = 3;
+  config.emit_records = false;
+
+  auto results = ppc::core::RunSweep(config, factory, factory);
+  ASSERT_EQ(results.strong.size(), 4U);
+  ASSERT_EQ(results.weak.size(), 4U);
+  EXPECT_EQ(results.strong[1].size, 1000U);
+  EXPECT_EQ(results.strong[1].threads, 2);
+  EXPECT_EQ(results.weak[1].size, 2000U);
+  EXPECT_EQ(results.weak[3].size, 8000U);
+  for (const auto &point : results.strong) {
+    EXPECT_GT(point.time_sec, 0.0);
+    EXPECT_NEAR(point.speedup, point.baseline_sec / point.time_sec, 1e-12);
+    EXPECT_NEAR(point.efficiency, point.speedup / point.threads, 1e-12);
+  }
+  for (const auto &point : results.weak) {
+    EXPECT_NEAR(point.efficiency, point.baseline_sec / point.time_sec, 1e-12);
+  }
+  // thread counts are applied before every parallel point and restored at the end
+  EXPECT_EQ(applied_threads.size(), 9U);
+  EXPECT_EQ(applied_threads.back(), 3);
+
+  std::ostringstream csv;
+  ppc::core::WriteSweepCsv(csv, results);
+  const auto table = csv.str();
+  EXPECT_EQ(std::ranges::count(table, '\n'), 9);
+  EXPECT_EQ(table.find("strong,1000,1,1,"), table.find('\n') + 1);
+}
+
+TEST(perf_tests, check_perf_budget) {
+  auto perf_results = std::make_shared<ppc::core::PerfResults>();
+  perf_results->type_of_running = ppc::core::PerfResults::TypeOfRunning::kPipeline;
+  perf_results->time_sec = 20.0;
+  perf_results->stats.count = 1;
+  perf_results->stats.median = 20.0;
+  const auto previous_config = ppc::util::GetBudgetConfig();
+  const auto cout_precision = std::cout.precision();
+  const auto cout_flags = std::cout.flags();
+
+  // the wall-clock cap can be lifted for bigger inputs
+  std::istringstream no_cap("core/perf perf_max_time=0");
+  ppc::util::SetBudgetConfig(ppc::util::BudgetConfig::Parse(no_cap));
+  EXPECT_NO_THROW(ppc::core::Perf::PrintPerfStatistic(perf_results));
+
+  // the median is checked against the stored baseline of this type of running
+  std::istringstream baseline("core/perf perf_max_time=0\ncore/perf:pipeline baseline_median=18 max_regression=0.05");
+  ppc::util::SetBudgetConfig(ppc::util::BudgetConfig::Parse(baseline));
+  EXPECT_THROW(ppc::core::Perf::PrintPerfStatistic(perf_results), std::runtime_error);
+  perf_results->stats.median = 18.5;
+  EXPECT_NO_THROW(ppc::core::Perf::PrintPerfStatistic(perf_results));
+  // the baseline line leaves the formatting of std::cout alone
+  EXPECT_EQ(std::cout.precision(), cout_precision);
+  EXPECT_EQ(std::cout.flags(), cout_flags);
+
+  ppc::util::SetBudgetConfig({});
+  EXPECT_THROW(ppc::core::Perf::PrintPerfStatistic(perf_results), std::runtime_error);
+  ppc::util::SetBudgetConfig(previous_config);
+}
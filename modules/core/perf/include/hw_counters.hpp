@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace ppc::core {
+
+enum class HwEvent : uint8_t { kCycles, kInstructions, kLlcMisses, kBranchMisses, kDtlbMisses };
+
+struct HwCount {
+  HwEvent event;
+  uint64_t value = 0;
+};
+
+// "cycles", "instructions", "llc_misses", "branch_misses", "dtlb_misses"
+const char* HwEventName(HwEvent event);
+// Comma-separated event names, e.g. "cycles,instructions"; throws std::invalid_argument on an unknown name
+std::vector<HwEvent> ParseHwEvents(std::string_view names);
+
+// User-space hardware counters of the calling process read through perf_event_open (Linux only).
+// Every thread that exists on construction gets its own counter and the counts are summed; threads started
+// later are counted once they exit.
+// Events that cannot be opened (no PMU in a VM, perf_event_paranoid, other OS) are silently dropped.
+class HwCounterGroup {
+ public:
+  explicit HwCounterGroup(const std::vector<HwEvent>& events);
+  HwCounterGroup(const HwCounterGroup&) = delete;
+  HwCounterGroup& operator=(const HwCounterGroup&) = delete;
+  HwCounterGroup(HwCounterGroup&&) = delete;
+  HwCounterGroup& operator=(HwCounterGroup&&) = delete;
+  ~HwCounterGroup();
+
+  void Start();
+  void Stop();
+  // Counts of the opened events, scaled up if the kernel multiplexed the counters
+  [[nodiscard]] std::vector<HwCount> Read() const;
+
+ private:
+  // file descriptors of every event, one per thread
+  std::vector<std::pair<HwEvent, std::vector<int>>> counters_;
+};
+
+}  // namespace ppc::core
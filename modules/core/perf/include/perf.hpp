@@ -3,7 +3,9 @@
 #include <cstdint>
 #include <functional>
 #include <memory>
+#include <vector>
 
+#include "core/perf/include/hw_counters.hpp"
 #include "core/task/include/task.hpp"
 
 namespace ppc::core {
@@ -11,16 +13,67 @@ namespace ppc::core {
 struct PerfAttr {
   // count of task's running
   uint64_t num_running;
+  // count of untimed runs before measurement (first touch, page faults, caches)
+  uint64_t num_warmup = 0;
   std::function<double()> current_timer = [&] { return 0.0; };
+  // Multi-process runs (optional, see core/mpi/include/perf_mpi.hpp):
+  // synchronizes the start of measurement of all processes
+  std::function<void()> barrier = nullptr;
+  // returns elapsed times of all processes given the local one
+  std::function<std::vector<double>(double)> gather_times = nullptr;
+  // hardware events counted over the measured runs (see hw_counters.hpp);
+  // if empty, the comma-separated list from PPC_PERF_EVENTS is used
+  std::vector<HwEvent> hw_events = {};
+};
+
+// Summary of per-iteration samples (in seconds)
+struct PerfStatistics {
+  uint64_t count = 0;
+  double min = 0.0;
+  double max = 0.0;
+  double mean = 0.0;
+  double median = 0.0;
+  double p95 = 0.0;
+  double stddev = 0.0;
+  // 95% confidence interval of the mean
+  double ci_low = 0.0;
+  double ci_high = 0.0;
+};
+
+// Elapsed time of the measured runs over processes (in seconds)
+struct PerfRankStatistics {
+  std::vector<double> times;
+  double min = 0.0;
+  double max = 0.0;
+  double mean = 0.0;
+  // max / mean: 1.0 means perfectly balanced processes
+  double imbalance = 1.0;
 };
 
 struct PerfResults {
-  // measurement of task's time (in seconds)
+  // measurement of task's time (in seconds); the slowest process time if times are gathered
   double time_sec = 0.0;
+  // filled only if PerfAttr::gather_times is set
+  PerfRankStatistics ranks;
+  // time of every measured iteration (in seconds)
+  std::vector<double> samples;
+  PerfStatistics stats;
+  // hardware counters of this process over the measured runs; only events available on the machine
+  std::vector<HwCount> hw_counters;
+  // total count of input elements of the measured task
+  uint64_t input_size = 0;
+  // phase and region times of the task over the measured runs
+  TaskStats task_stats;
   enum TypeOfRunning : uint8_t { kPipeline, kTaskRun, kNone } type_of_running = kNone;
+  // limit of time_sec unless perf_max_time is set in the budget config (see core/util/include/budget.hpp)
   constexpr static double kMaxTime = 10.0;
 };
 
+// Compute min/median/mean/p95/stddev and the confidence interval of samples
+PerfStatistics ComputePerfStatistics(std::vector<double> samples);
+// One-sided Welch's t-test (95%): is current slower than baseline beyond run-to-run noise
+bool IsSignificantlySlower(const PerfStatistics& baseline, const PerfStatistics& current);
+
 class Perf {
  public:
   // Init performance analysis with initialized task and initialized data
@@ -33,13 +86,14 @@ class Perf {
   void PipelineRun(const std::shared_ptr<PerfAttr>& perf_attr, const std::shared_ptr<PerfResults>& perf_results) const;
   // Check performance of task's Run() function
   void TaskRun(const std::shared_ptr<PerfAttr>& perf_attr, const std::shared_ptr<PerfResults>& perf_results) const;
-  // Pint results for automation checkers
+  // Pint results for automation checkers; also emits a structured record (see perf_record.hpp).
+  // Throws if the time exceeds the budget or the median regressed against the stored baseline.
   static void PrintPerfStatistic(const std::shared_ptr<PerfResults>& perf_results);
 
  private:
   std::shared_ptr<Task> task_;
   static void CommonRun(const std::shared_ptr<PerfAttr>& perf_attr, const std::function<void()>& pipeline,
-                        const std::shared_ptr<PerfResults>& perf_results);
+                        const std::function<void()>& before_measure, const std::shared_ptr<PerfResults>& perf_results);
 };
 
 }  // namespace ppc::core
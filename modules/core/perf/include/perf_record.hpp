@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "core/perf/include/hw_counters.hpp"
+#include "core/perf/include/perf.hpp"
+#include "core/task/include/task.hpp"
+
+namespace ppc::core {
+
+// One performance run in a machine-readable form
+struct PerfRecord {
+  // task directory name and technology (seq/mpi/omp/tbb/stl/all) taken from the test source path
+  std::string task;
+  std::string technology;
+  std::string test;
+  std::string type_of_running;
+  int processes = 1;
+  int threads = 1;
+  uint64_t input_size = 0;
+  double time_sec = 0.0;
+  PerfStatistics stats;
+  std::vector<double> samples;
+  PerfRankStatistics ranks;
+  TaskStats task_stats;
+  std::vector<HwCount> hw_counters;
+  std::string build_type;
+  std::string compiler;
+  std::string build_flags;
+};
+
+enum class PerfOutputFormat : uint8_t { kJson, kCsv };
+
+// Fill a record from perf results; test_file is the path of the perf test source
+PerfRecord MakePerfRecord(const PerfResults& perf_results, const std::string& test_file, const std::string& test_name);
+// Write one record as a JSON line or a CSV row
+void WritePerfRecord(std::ostream& out, const PerfRecord& record, PerfOutputFormat format);
+void WritePerfCsvHeader(std::ostream& out);
+// Append a record to the destination set by PPC_PERF_OUTPUT (file path or "-" for stdout)
+// in the format set by PPC_PERF_FORMAT ("json" by default or "csv"); does nothing if PPC_PERF_OUTPUT is unset
+void EmitPerfRecord(const PerfRecord& record);
+
+}  // namespace ppc::core
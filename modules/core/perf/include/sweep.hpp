@@ -0,0 +1,68 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <ostream>
+#include <vector>
+
+#include "core/perf/include/perf.hpp"
+#include "core/task/include/task.hpp"
+
+namespace ppc::core {
+
+// A task ready for Perf together with the buffers its TaskData points to
+struct SweepCase {
+  std::shared_ptr<Task> task;
+  std::shared_ptr<void> data;
+};
+
+// Creates a task for the given problem size; the size should be proportional to the amount of work
+// for weak scaling to be meaningful (e.g. number of rows rather than matrix side)
+using SweepFactory = std::function<SweepCase(uint64_t size)>;
+
+struct SweepConfig {
+  std::vector<uint64_t> sizes;
+  // thread counts to try; the current setting is used if empty
+  std::vector<int> threads;
+  // applies a thread count before the parallel task is created (e.g. omp_set_num_threads)
+  std::function<void(int)> set_threads;
+  // reads the current thread count, restored after the sweep (e.g. omp_get_max_threads);
+  // without it the PPC_NUM_THREADS setting is restored
+  std::function<int()> get_threads;
+  // processes of the current run; the process count cannot change inside one run,
+  // process scaling is assembled from records of runs with different mpirun -np
+  int processes = 1;
+  // template of measurement settings for every point (timer, num_running, barrier, ...)
+  PerfAttr perf_attr{.num_running = 5};
+  // emit a structured record for every measured point (see perf_record.hpp)
+  bool emit_records = true;
+};
+
+struct SweepPoint {
+  uint64_t size = 0;
+  int threads = 1;
+  int processes = 1;
+  double time_sec = 0.0;
+  // time of the sequential baseline for the same amount of work per worker
+  double baseline_sec = 0.0;
+  double speedup = 0.0;
+  double efficiency = 0.0;
+};
+
+struct SweepResults {
+  // fixed total size, growing worker count
+  std::vector<SweepPoint> strong;
+  // fixed size per worker: the parallel task solves size * workers
+  std::vector<SweepPoint> weak;
+};
+
+// Run the parallel task over sizes x threads and compare it with the sequential counterpart.
+// Without a sequential factory the parallel task with a single worker is the baseline.
+SweepResults RunSweep(const SweepConfig& config, const SweepFactory& parallel, const SweepFactory& sequential = {});
+// Human-readable strong and weak scaling tables
+void PrintSweep(std::ostream& out, const SweepResults& results);
+// "scaling,size,threads,processes,time_sec,baseline_sec,speedup,efficiency" rows
+void WriteSweepCsv(std::ostream& out, const SweepResults& results);
+
+}  // namespace ppc::core
@@ -0,0 +1,191 @@
+#include "core/perf/include/hw_counters.hpp"
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include <array>
+#include <charconv>
+#include <cstdint>
+#include <filesystem>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+namespace {
+
+constexpr std::array<std::pair<ppc::core::HwEvent, const char*>, 5> kEventNames = {{
+    {ppc::core::HwEvent::kCycles, "cycles"},
+    {ppc::core::HwEvent::kInstructions, "instructions"},
+    {ppc::core::HwEvent::kLlcMisses, "llc_misses"},
+    {ppc::core::HwEvent::kBranchMisses, "branch_misses"},
+    {ppc::core::HwEvent::kDtlbMisses, "dtlb_misses"},
+}};
+
+#ifdef __linux__
+int OpenCounter(ppc::core::HwEvent event, pid_t thread) {
+  perf_event_attr attr{};
+  attr.size = sizeof(attr);
+  attr.type = PERF_TYPE_HARDWARE;
+  switch (event) {
+    case ppc::core::HwEvent::kCycles:
+      attr.config = PERF_COUNT_HW_CPU_CYCLES;
+      break;
+    case ppc::core::HwEvent::kInstructions:
+      attr.config = PERF_COUNT_HW_INSTRUCTIONS;
+      break;
+    case ppc::core::HwEvent::kLlcMisses:
+      attr.config = PERF_COUNT_HW_CACHE_MISSES;
+      break;
+    case ppc::core::HwEvent::kBranchMisses:
+      attr.config = PERF_COUNT_HW_BRANCH_MISSES;
+      break;
+    case ppc::core::HwEvent::kDtlbMisses:
+      attr.type = PERF_TYPE_HW_CACHE;
+      attr.config = PERF_COUNT_HW_CACHE_DTLB | (PERF_COUNT_HW_CACHE_OP_READ << 8U) |
+                    (PERF_COUNT_HW_CACHE_RESULT_MISS << 16U);
+      break;
+  }
+  attr.disabled = 1;
+  attr.inherit = 1;
+  attr.exclude_kernel = 1;
+  attr.exclude_hv = 1;
+  attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+  return static_cast<int>(syscall(SYS_perf_event_open, &attr, thread, -1, -1, 0));
+}
+
+// Threads of the process: workers of OpenMP, TBB and ThreadPool usually exist long before a measurement
+std::vector<pid_t> ProcessThreads() {
+  std::vector<pid_t> threads;
+  std::error_code ec;
+  for (const auto& entry : std::filesystem::directory_iterator("/proc/self/task", ec)) {
+    const auto name = entry.path().filename().string();
+    pid_t thread = 0;
+    const auto [end, error] = std::from_chars(name.data(), name.data() + name.size(), thread);
+    if (error == std::errc() && end == name.data() + name.size()) {
+      threads.push_back(thread);
+    }
+  }
+  if (threads.empty()) {
+    threads.push_back(0);
+  }
+  return threads;
+}
+#endif
+
+}  // namespace
+
+const char* ppc::core::HwEventName(HwEvent event) {
+  for (const auto& [known, name] : kEventNames) {
+    if (known == event) {
+      return name;
+    }
+  }
+  return "unknown";
+}
+
+std::vector<ppc::core::HwEvent> ppc::core::ParseHwEvents(std::string_view names) {
+  std::vector<HwEvent> events;
+  while (!names.empty()) {
+    auto comma = names.find(',');
+    auto name = names.substr(0, comma);
+    names = comma == std::string_view::npos ? std::string_view() : names.substr(comma + 1);
+    if (name.empty()) {
+      continue;
+    }
+    bool found = false;
+    for (const auto& [event, known] : kEventNames) {
+      if (name == known) {
+        events.push_back(event);
+        found = true;
+      }
+    }
+    if (!found) {
+      throw std::invalid_argument("Unknown hardware event: " + std::string(name));
+    }
+  }
+  return events;
+}
+
+ppc::core::HwCounterGroup::HwCounterGroup(const std::vector<HwEvent>& events) {
+#ifdef __linux__
+  const auto threads = ProcessThreads();
+  for (auto event : events) {
+    std::vector<int> fds;
+    for (auto thread : threads) {
+      int fd = OpenCounter(event, thread);
+      if (fd >= 0) {
+        fds.push_back(fd);
+      }
+    }
+    if (!fds.empty()) {
+      counters_.emplace_back(event, std::move(fds));
+    }
+  }
+#endif
+}
+
+ppc::core::HwCounterGroup::~HwCounterGroup() {
+#ifdef __linux__
+  for (const auto& counter : counters_) {
+    for (int fd : counter.second) {
+      close(fd);
+    }
+  }
+#endif
+}
+
+void ppc::core::HwCounterGroup::Start() {
+#ifdef __linux__
+  for (const auto& counter : counters_) {
+    for (int fd : counter.second) {
+      ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+      ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+    }
+  }
+#endif
+}
+
+void ppc::core::HwCounterGroup::Stop() {
+#ifdef __linux__
+  for (const auto& counter : counters_) {
+    for (int fd : counter.second) {
+      ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+    }
+  }
+#endif
+}
+
+std::vector<ppc::core::HwCount> ppc::core::HwCounterGroup::Read() const {
+  std::vector<HwCount> counts;
+#ifdef __linux__
+  for (const auto& [event, fds] : counters_) {
+    uint64_t total = 0;
+    bool counted = false;
+    for (int fd : fds) {
+      // value, time enabled, time running
+      std::array<uint64_t, 3> data{};
+      if (read(fd, data.data(), sizeof(data)) != static_cast<ssize_t>(sizeof(data)) || data[2] == 0) {
+        continue;
+      }
+      auto value = data[0];
+      if (data[2] < data[1]) {
+        value = static_cast<uint64_t>(static_cast<double>(value) * static_cast<double>(data[1]) /
+                                      static_cast<double>(data[2]));
+      }
+      total += value;
+      counted = true;
+    }
+    if (counted) {
+      counts.push_back({.event = event, .value = total});
+    }
+  }
+#endif
+  return counts;
+}
@@ -2,6 +2,10 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
 #include <cstdint>
 #include <functional>
 #include <iomanip>
@@ -10,8 +14,136 @@
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <utility>
+#include <vector>
 
+#include "core/perf/include/hw_counters.hpp"
+#include "core/perf/include/perf_record.hpp"
 #include "core/task/include/task.hpp"
+#include "core/util/include/budget.hpp"
+#include "core/util/include/util.hpp"
+
+namespace {
+
+// Two-sided 95% (one-sided 97.5%) critical values of Student's t-distribution for 1..30 degrees of freedom
+constexpr std::array<double, 30> kStudentT975 = {12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365, 2.306, 2.262, 2.228,
+                                                 2.201,  2.179, 2.160, 2.145, 2.131, 2.120, 2.110, 2.101, 2.093, 2.086,
+                                                 2.080,  2.074, 2.069, 2.064, 2.060, 2.056, 2.052, 2.048, 2.045, 2.042};
+// One-sided 95% critical values of Student's t-distribution for 1..30 degrees of freedom
+constexpr std::array<double, 30> kStudentT95 = {6.314, 2.920, 2.353, 2.132, 2.015, 1.943, 1.895, 1.860, 1.833, 1.812,
+                                                1.796, 1.782, 1.771, 1.761, 1.753, 1.746, 1.740, 1.734, 1.729, 1.725,
+                                                1.721, 1.717, 1.714, 1.711, 1.708, 1.706, 1.703, 1.701, 1.699, 1.697};
+
+double CriticalValue(const std::array<double, 30>& table, double normal_value, double degrees_of_freedom) {
+  if (degrees_of_freedom < 1.0) {
+    return table.front();
+  }
+  if (degrees_of_freedom > static_cast<double>(table.size())) {
+    return normal_value;
+  }
+  return table[static_cast<std::size_t>(degrees_of_freedom) - 1];
+}
+
+// Linear interpolation between closest ranks of sorted samples
+double Quantile(const std::vector<double>& sorted, double q) {
+  auto pos = q * static_cast<double>(sorted.size() - 1);
+  auto lower = static_cast<std::size_t>(std::floor(pos));
+  auto upper = std::min(lower + 1, sorted.size() - 1);
+  auto frac = pos - static_cast<double>(lower);
+  return sorted[lower] + ((sorted[upper] - sorted[lower]) * frac);
+}
+
+uint64_t InputSize(const ppc::core::TaskData& task_data) {
+  uint64_t size = 0;
+  for (auto count : task_data.inputs_count) {
+    size += count;
+  }
+  return size;
+}
+
+void PrintTaskStats(const ppc::core::TaskStats& task_stats) {
+  const std::array<std::pair<const char*, const ppc::core::TaskTimer*>, 4> phases = {{
+      {"validation", &task_stats.validation},
+      {"pre_processing", &task_stats.pre_processing},
+      {"run", &task_stats.run},
+      {"post_processing", &task_stats.post_processing}}};
+  std::ostringstream line;
+  line << std::fixed << std::setprecision(10);
+  for (const auto& [name, timer] : phases) {
+    if (timer->calls > 0) {
+      line << ' ' << name << '=' << timer->total_sec;
+    }
+  }
+  for (const auto& [name, timer] : task_stats.regions) {
+    line << ' ' << name << '=' << timer.total_sec;
+  }
+  if (!line.str().empty()) {
+    std::cout << "  phases:" << line.str() << '\n';
+  }
+  const auto& memory = task_stats.memory;
+  if (memory.allocations > 0) {
+    std::cout << "  memory: allocations=" << memory.allocations << " bytes=" << memory.bytes
+              << " peak_bytes=" << memory.peak_bytes << " upstream_allocations=" << memory.upstream_allocations
+              << " upstream_bytes=" << memory.upstream_bytes << '\n';
+  }
+}
+
+void PrintHwCounters(const std::vector<ppc::core::HwCount>& hw_counters) {
+  if (hw_counters.empty()) {
+    return;
+  }
+  uint64_t cycles = 0;
+  uint64_t instructions = 0;
+  // formatted locally so std::cout keeps its flags
+  std::ostringstream line;
+  line << "  hw:";
+  for (const auto& count : hw_counters) {
+    line << ' ' << ppc::core::HwEventName(count.event) << '=' << count.value;
+    if (count.event == ppc::core::HwEvent::kCycles) {
+      cycles = count.value;
+    } else if (count.event == ppc::core::HwEvent::kInstructions) {
+      instructions = count.value;
+    }
+  }
+  line << std::fixed << std::setprecision(3);
+  if (cycles > 0 && instructions > 0) {
+    line << " ipc=" << static_cast<double>(instructions) / static_cast<double>(cycles);
+  }
+  // misses per thousand instructions
+  for (const auto& count : hw_counters) {
+    if (instructions > 0 && count.event != ppc::core::HwEvent::kCycles &&
+        count.event != ppc::core::HwEvent::kInstructions) {
+      line << ' ' << ppc::core::HwEventName(count.event)
+           << "_pki=" << 1000.0 * static_cast<double>(count.value) / static_cast<double>(instructions);
+    }
+  }
+  std::cout << line.str() << '\n';
+}
+
+// Regression gate: the median of one run must stay within max_regression of the stored baseline
+void CheckBaseline(const ppc::util::TaskBudget& budget, double median) {
+  if (!budget.baseline_median || *budget.baseline_median <= 0.0) {
+    return;
+  }
+  const auto baseline = *budget.baseline_median;
+  const auto change = (median - baseline) / baseline;
+  std::ostringstream line;
+  line << std::fixed << std::setprecision(10) << "  baseline: median=" << median << " stored=" << baseline
+       << std::setprecision(1) << " change=" << std::showpos << change * 100.0 << '%' << std::noshowpos;
+  if (budget.max_regression) {
+    line << " allowed=+" << *budget.max_regression * 100.0 << '%';
+  }
+  std::cout << line.str() << '\n';
+  if (budget.max_regression && change > *budget.max_regression) {
+    std::stringstream err_msg;
+    err_msg << '\n' << std::fixed << "Performance regression: median " << std::setprecision(10) << median << " secs is "
+            << std::setprecision(1) << change * 100.0 << "% slower than the baseline " << std::setprecision(10)
+            << baseline << " secs (allowed " << std::setprecision(1) << *budget.max_regression * 100.0 << "%)" << '\n';
+    throw std::runtime_error(err_msg.str());
+  }
+}
+
+}  // namespace
 
 ppc::core::Perf::Perf(const std::shared_ptr<Task>& task_ptr) { SetTask(task_ptr); }
 
@@ -23,6 +155,7 @@ void ppc::core::Perf::SetTask(const std::shared_ptr<Task>& task_ptr) {
 void ppc::core::Perf::PipelineRun(const std::shared_ptr<PerfAttr>& perf_attr,
                                   const std::shared_ptr<ppc::core::PerfResults>& perf_results) const {
   perf_results->type_of_running = PerfResults::TypeOfRunning::kPipeline;
+  perf_results->input_size = InputSize(*task_->GetData());
 
   CommonRun(
       perf_attr,
@@ -32,16 +165,19 @@ void ppc::core::Perf::PipelineRun(const std::shared_ptr<PerfAttr>& perf_attr,
         task_->Run();
         task_->PostProcessing();
       },
-      perf_results);
+      [&]() { task_->ResetStats(); }, perf_results);
+  perf_results->task_stats = task_->GetStats();
 }
 
 void ppc::core::Perf::TaskRun(const std::shared_ptr<PerfAttr>& perf_attr,
                               const std::shared_ptr<ppc::core::PerfResults>& perf_results) const {
   perf_results->type_of_running = PerfResults::TypeOfRunning::kTaskRun;
+  perf_results->input_size = InputSize(*task_->GetData());
 
   task_->Validation();
   task_->PreProcessing();
-  CommonRun(perf_attr, [&]() { task_->Run(); }, perf_results);
+  CommonRun(perf_attr, [&]() { task_->Run(); }, [&]() { task_->ResetStats(); }, perf_results);
+  perf_results->task_stats = task_->GetStats();
   task_->PostProcessing();
 
   task_->Validation();
@@ -51,17 +187,114 @@ void ppc::core::Perf::TaskRun(const std::shared_ptr<PerfAttr>& perf_attr,
 }
 
 void ppc::core::Perf::CommonRun(const std::shared_ptr<PerfAttr>& perf_attr, const std::function<void()>& pipeline,
+                                const std::function<void()>& before_measure,
                                 const std::shared_ptr<ppc::core::PerfResults>& perf_results) {
+  for (uint64_t i = 0; i < perf_attr->num_warmup; i++) {
+    pipeline();
+  }
+  before_measure();
+
+  auto hw_events = perf_attr->hw_events;
+  if (hw_events.empty()) {
+    hw_events = ParseHwEvents(ppc::util::GetEnv("PPC_PERF_EVENTS"));
+  }
+  HwCounterGroup hw_counters(hw_events);
+
+  perf_results->samples.clear();
+  perf_results->samples.reserve(perf_attr->num_running);
+  if (perf_attr->barrier) {
+    perf_attr->barrier();
+  }
+  hw_counters.Start();
   auto begin = perf_attr->current_timer();
+  auto iteration_begin = begin;
   for (uint64_t i = 0; i < perf_attr->num_running; i++) {
     pipeline();
+    auto iteration_end = perf_attr->current_timer();
+    perf_results->samples.push_back(iteration_end - iteration_begin);
+    iteration_begin = iteration_end;
+  }
+  hw_counters.Stop();
+  perf_results->hw_counters = hw_counters.Read();
+  static bool hw_counters_warned = false;
+  if (!hw_events.empty() && perf_results->hw_counters.empty() && !std::exchange(hw_counters_warned, true)) {
+    std::cerr << "Hardware performance counters are not available on this machine\n";
+  }
+  perf_results->time_sec = iteration_begin - begin;
+  perf_results->stats = ComputePerfStatistics(perf_results->samples);
+
+  perf_results->ranks = PerfRankStatistics();
+  if (perf_attr->gather_times) {
+    auto& ranks = perf_results->ranks;
+    ranks.times = perf_attr->gather_times(perf_results->time_sec);
+    if (!ranks.times.empty()) {
+      auto [min, max] = std::ranges::minmax_element(ranks.times);
+      ranks.min = *min;
+      ranks.max = *max;
+      for (auto time : ranks.times) {
+        ranks.mean += time;
+      }
+      ranks.mean /= static_cast<double>(ranks.times.size());
+      ranks.imbalance = ranks.mean > 0.0 ? ranks.max / ranks.mean : 1.0;
+      perf_results->time_sec = ranks.max;
+    }
   }
-  auto end = perf_attr->current_timer();
-  perf_results->time_sec = end - begin;
+}
+
+ppc::core::PerfStatistics ppc::core::ComputePerfStatistics(std::vector<double> samples) {
+  PerfStatistics stats;
+  if (samples.empty()) {
+    return stats;
+  }
+  std::ranges::sort(samples);
+
+  auto count = static_cast<double>(samples.size());
+  double sum = 0.0;
+  for (auto sample : samples) {
+    sum += sample;
+  }
+  stats.count = samples.size();
+  stats.min = samples.front();
+  stats.max = samples.back();
+  stats.mean = sum / count;
+  stats.median = Quantile(samples, 0.5);
+  stats.p95 = Quantile(samples, 0.95);
+
+  if (samples.size() > 1) {
+    double sq_sum = 0.0;
+    for (auto sample : samples) {
+      sq_sum += (sample - stats.mean) * (sample - stats.mean);
+    }
+    stats.stddev = std::sqrt(sq_sum / (count - 1.0));
+  }
+  auto half_width = CriticalValue(kStudentT975, 1.960, count - 1.0) * stats.stddev / std::sqrt(count);
+  stats.ci_low = stats.mean - half_width;
+  stats.ci_high = stats.mean + half_width;
+  return stats;
+}
+
+bool ppc::core::IsSignificantlySlower(const PerfStatistics& baseline, const PerfStatistics& current) {
+  if (baseline.count < 2 || current.count < 2 || current.mean <= baseline.mean) {
+    return false;
+  }
+  auto base_var = baseline.stddev * baseline.stddev / static_cast<double>(baseline.count);
+  auto cur_var = current.stddev * current.stddev / static_cast<double>(current.count);
+  auto var = base_var + cur_var;
+  if (var == 0.0) {
+    return true;
+  }
+  auto t = (current.mean - baseline.mean) / std::sqrt(var);
+  // Welch-Satterthwaite degrees of freedom
+  auto df = (var * var) / ((base_var * base_var / static_cast<double>(baseline.count - 1)) +
+                           (cur_var * cur_var / static_cast<double>(current.count - 1)));
+  return t > CriticalValue(kStudentT95, 1.645, df);
 }
 
 void ppc::core::Perf::PrintPerfStatistic(const std::shared_ptr<PerfResults>& perf_results) {
-  std::string relative_path(::testing::UnitTest::GetInstance()->current_test_info()->file());
+  const auto* test_info = ::testing::UnitTest::GetInstance()->current_test_info();
+  EmitPerfRecord(MakePerfRecord(*perf_results, test_info->file(), test_info->name()));
+
+  std::string relative_path(test_info->file());
   std::string ppc_regex_template("parallel_programming_course");
   std::string perf_regex_template("perf_tests");
   std::string type_test_name;
@@ -82,14 +315,35 @@ void ppc::core::Perf::PrintPerfStatistic(const std::shared_ptr<PerfResults>& per
   auto last_found_position = relative_path.find(perf_regex_template) - 1;
   relative_path.erase(last_found_position, relative_path.length() - 1);
 
+  const auto budget = ppc::util::CurrentTaskBudget(type_test_name);
+  const auto max_time = budget.perf_max_time.value_or(PerfResults::kMaxTime);
+
   std::stringstream perf_res_str;
-  if (time_secs < PerfResults::kMaxTime) {
+  if (max_time <= 0.0 || time_secs < max_time) {
     perf_res_str << std::fixed << std::setprecision(10) << time_secs;
     std::cout << relative_path << ":" << type_test_name << ":" << perf_res_str.str() << '\n';
+    const auto& stats = perf_results->stats;
+    if (stats.count > 0) {
+      std::ostringstream line;
+      line << std::fixed << std::setprecision(10) << "  samples=" << stats.count << " min=" << stats.min
+           << " median=" << stats.median << " mean=" << stats.mean << " p95=" << stats.p95 << " stddev=" << stats.stddev
+           << " ci95=[" << stats.ci_low << ", " << stats.ci_high << "]\n";
+      std::cout << line.str();
+    }
+    PrintTaskStats(perf_results->task_stats);
+    PrintHwCounters(perf_results->hw_counters);
+    const auto& ranks = perf_results->ranks;
+    if (!ranks.times.empty()) {
+      std::ostringstream line;
+      line << std::fixed << std::setprecision(10) << "  processes=" << ranks.times.size() << " min=" << ranks.min
+           << " mean=" << ranks.mean << " max=" << ranks.max << " imbalance=" << ranks.imbalance << '\n';
+      std::cout << line.str();
+    }
+    CheckBaseline(budget, stats.count > 0 ? stats.median : time_secs);
   } else {
     std::stringstream err_msg;
     err_msg << '\n' << "Task execute time need to be: ";
-    err_msg << "time < " << PerfResults::kMaxTime << " secs." << '\n';
+    err_msg << "time < " << max_time << " secs." << '\n';
     err_msg << "Original time in secs: " << time_secs << '\n';
     perf_res_str << std::fixed << std::setprecision(10) << -1.0;
     std::cout << relative_path << ":" << type_test_name << ":" << perf_res_str.str() << '\n';
@@ -0,0 +1,207 @@
+#include "core/perf/include/perf_record.hpp"
+
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "core/perf/include/hw_counters.hpp"
+#include "core/perf/include/perf.hpp"
+#include "core/task/include/task.hpp"
+#include "core/util/include/util.hpp"
+
+#ifndef PPC_BUILD_TYPE
+#define PPC_BUILD_TYPE ""
+#endif
+#ifndef PPC_BUILD_FLAGS
+#define PPC_BUILD_FLAGS ""
+#endif
+
+namespace {
+
+std::string CompilerName() {
+#if defined(__clang__)
+  return "clang " __clang_version__;
+#elif defined(__GNUC__)
+  return "gcc " __VERSION__;
+#elif defined(_MSC_VER)
+  return "msvc " + std::to_string(_MSC_FULL_VER);
+#else
+  return "unknown";
+#endif
+}
+
+std::string JsonEscape(const std::string& str) {
+  std::ostringstream out;
+  for (char c : str) {
+    switch (c) {
+      case '"':
+        out << "\\\"";
+        break;
+      case '\\':
+        out << "\\\\";
+        break;
+      case '\n':
+        out << "\\n";
+        break;
+      case '\t':
+        out << "\\t";
+        break;
+      default:
+        if (static_cast<unsigned char>(c) < 0x20) {
+          out << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(c) << std::dec;
+        } else {
+          out << c;
+        }
+    }
+  }
+  return out.str();
+}
+
+std::string CsvEscape(const std::string& str) {
+  if (str.find_first_of(",\"\n") == std::string::npos) {
+    return str;
+  }
+  std::string out = "\"";
+  for (char c : str) {
+    if (c == '"') {
+      out += '"';
+    }
+    out += c;
+  }
+  return out + "\"";
+}
+
+void WriteJsonTimer(std::ostream& out, const std::string& name, const ppc::core::TaskTimer& timer) {
+  out << '"' << name << R"(":{"calls":)" << timer.calls << R"(,"total_sec":)" << timer.total_sec << R"(,"max_sec":)"
+      << timer.max_sec << '}';
+}
+
+}  // namespace
+
+ppc::core::PerfRecord ppc::core::MakePerfRecord(const PerfResults& perf_results, const std::string& test_file,
+                                                const std::string& test_name) {
+  PerfRecord record;
+  ppc::util::ParseTestPath(test_file, record.technology, record.task);
+  record.test = test_name;
+  if (perf_results.type_of_running == PerfResults::TypeOfRunning::kTaskRun) {
+    record.type_of_running = "task_run";
+  } else if (perf_results.type_of_running == PerfResults::TypeOfRunning::kPipeline) {
+    record.type_of_running = "pipeline";
+  } else {
+    record.type_of_running = "none";
+  }
+  record.processes = perf_results.ranks.times.empty() ? ppc::util::GetNumProcesses()
+                                                      : static_cast<int>(perf_results.ranks.times.size());
+  record.threads = ppc::util::GetPPCNumThreads();
+  record.input_size = perf_results.input_size;
+  record.time_sec = perf_results.time_sec;
+  record.stats = perf_results.stats;
+  record.samples = perf_results.samples;
+  record.ranks = perf_results.ranks;
+  record.task_stats = perf_results.task_stats;
+  record.hw_counters = perf_results.hw_counters;
+  record.build_type = PPC_BUILD_TYPE;
+  record.compiler = CompilerName();
+  record.build_flags = PPC_BUILD_FLAGS;
+  return record;
+}
+
+void ppc::core::WritePerfCsvHeader(std::ostream& out) {
+  out << "task,technology,test,type_of_running,processes,threads,input_size,time_sec,count,min,median,mean,p95,"
+         "stddev,ci_low,ci_high,samples,rank_min,rank_mean,rank_max,imbalance,hw_counters,build_type,compiler,"
+         "build_flags\n";
+}
+
+void ppc::core::WritePerfRecord(std::ostream& out, const PerfRecord& record, PerfOutputFormat format) {
+  std::ostringstream line;
+  line << std::setprecision(10);
+  const auto& stats = record.stats;
+  if (format == PerfOutputFormat::kCsv) {
+    std::ostringstream samples;
+    samples << std::setprecision(10);
+    for (std::size_t i = 0; i < record.samples.size(); i++) {
+      samples << (i == 0 ? "" : ";") << record.samples[i];
+    }
+    std::ostringstream hw_counters;
+    for (std::size_t i = 0; i < record.hw_counters.size(); i++) {
+      hw_counters << (i == 0 ? "" : ";") << HwEventName(record.hw_counters[i].event) << '='
+                  << record.hw_counters[i].value;
+    }
+    line << CsvEscape(record.task) << ',' << CsvEscape(record.technology) << ',' << CsvEscape(record.test) << ','
+         << record.type_of_running << ',' << record.processes << ',' << record.threads << ',' << record.input_size
+         << ',' << record.time_sec << ',' << stats.count << ',' << stats.min << ',' << stats.median << ','
+         << stats.mean << ',' << stats.p95 << ',' << stats.stddev << ',' << stats.ci_low << ',' << stats.ci_high
+         << ',' << samples.str() << ',' << record.ranks.min << ',' << record.ranks.mean << ',' << record.ranks.max
+         << ',' << record.ranks.imbalance << ',' << hw_counters.str() << ',' << CsvEscape(record.build_type) << ','
+         << CsvEscape(record.compiler) << ',' << CsvEscape(record.build_flags) << '\n';
+  } else {
+    line << R"({"task":")" << JsonEscape(record.task) << R"(","technology":")" << JsonEscape(record.technology)
+         << R"(","test":")" << JsonEscape(record.test) << R"(","type_of_running":")" << record.type_of_running
+         << R"(","processes":)" << record.processes << R"(,"threads":)" << record.threads << R"(,"input_size":)"
+         << record.input_size << R"(,"time_sec":)" << record.time_sec << R"(,"stats":{"count":)" << stats.count
+         << R"(,"min":)" << stats.min << R"(,"max":)" << stats.max << R"(,"mean":)" << stats.mean
+         << R"(,"median":)" << stats.median << R"(,"p95":)" << stats.p95 << R"(,"stddev":)" << stats.stddev
+         << R"(,"ci_low":)" << stats.ci_low << R"(,"ci_high":)" << stats.ci_high << R"(},"samples":[)";
+    for (std::size_t i = 0; i < record.samples.size(); i++) {
+      line << (i == 0 ? "" : ",") << record.samples[i];
+    }
+    line << R"(],"ranks":{"min":)" << record.ranks.min << R"(,"mean":)" << record.ranks.mean << R"(,"max":)"
+         << record.ranks.max << R"(,"imbalance":)" << record.ranks.imbalance << R"(,"times":[)";
+    for (std::size_t i = 0; i < record.ranks.times.size(); i++) {
+      line << (i == 0 ? "" : ",") << record.ranks.times[i];
+    }
+    line << R"(]},"phases":{)";
+    WriteJsonTimer(line, "validation", record.task_stats.validation);
+    WriteJsonTimer(line << ',', "pre_processing", record.task_stats.pre_processing);
+    WriteJsonTimer(line << ',', "run", record.task_stats.run);
+    WriteJsonTimer(line << ',', "post_processing", record.task_stats.post_processing);
+    line << R"(},"regions":{)";
+    bool first = true;
+    for (const auto& [name, timer] : record.task_stats.regions) {
+      WriteJsonTimer(line << (first ? "" : ","), JsonEscape(name), timer);
+      first = false;
+    }
+    const auto& memory = record.task_stats.memory;
+    line << R"(},"memory":{"allocations":)" << memory.allocations << R"(,"bytes":)" << memory.bytes
+         << R"(,"peak_bytes":)" << memory.peak_bytes << R"(,"upstream_allocations":)" << memory.upstream_allocations
+         << R"(,"upstream_bytes":)" << memory.upstream_bytes;
+    line << R"(},"hw_counters":{)";
+    for (std::size_t i = 0; i < record.hw_counters.size(); i++) {
+      line << (i == 0 ? "" : ",") << '"' << HwEventName(record.hw_counters[i].event) << R"(":)"
+           << record.hw_counters[i].value;
+    }
+    line << R"(},"build":{"type":")" << JsonEscape(record.build_type) << R"(","compiler":")"
+         << JsonEscape(record.compiler) << R"(","flags":")" << JsonEscape(record.build_flags) << R"("}})" << '\n';
+  }
+  out << line.str();
+}
+
+void ppc::core::EmitPerfRecord(const PerfRecord& record) {
+  const auto destination = ppc::util::GetEnv("PPC_PERF_OUTPUT");
+  if (destination.empty()) {
+    return;
+  }
+  const auto format = ppc::util::GetEnv("PPC_PERF_FORMAT") == "csv" ? PerfOutputFormat::kCsv : PerfOutputFormat::kJson;
+
+  if (destination == "-") {
+    WritePerfRecord(std::cout, record, format);
+    return;
+  }
+  std::error_code ec;
+  const bool is_new = !std::filesystem::exists(destination, ec) || std::filesystem::file_size(destination, ec) == 0;
+  std::ofstream file(destination, std::ios::app);
+  if (!file) {
+    std::cerr << "Unable to open perf output file: " << destination << '\n';
+    return;
+  }
+  if (is_new && format == PerfOutputFormat::kCsv) {
+    WritePerfCsvHeader(file);
+  }
+  WritePerfRecord(file, record, format);
+}
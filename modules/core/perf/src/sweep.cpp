@@ -0,0 +1,155 @@
+#include "core/perf/include/sweep.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <map>
+#include <memory>
+#include <ostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "core/perf/include/perf.hpp"
+#include "core/perf/include/perf_record.hpp"
+#include "core/util/include/util.hpp"
+
+namespace {
+
+struct Point {
+  uint64_t size;
+  int threads;
+  int processes;
+  bool baseline;
+};
+
+// Median time of one Run() of the task
+double Measure(const ppc::core::SweepConfig& config, const ppc::core::SweepCase& sweep_case, const Point& point) {
+  if (!sweep_case.task) {
+    throw std::invalid_argument("Sweep factory returned no task");
+  }
+  auto perf_attr = std::make_shared<ppc::core::PerfAttr>(config.perf_attr);
+  const auto t0 = std::chrono::steady_clock::now();
+  perf_attr->current_timer = [t0] {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+  };
+  // the sequential baseline runs independently on every process
+  if (point.baseline) {
+    perf_attr->barrier = nullptr;
+    perf_attr->gather_times = nullptr;
+  }
+  auto perf_results = std::make_shared<ppc::core::PerfResults>();
+  ppc::core::Perf perf(sweep_case.task);
+  perf.TaskRun(perf_attr, perf_results);
+
+  if (config.emit_records) {
+    const auto* test_info = ::testing::UnitTest::GetInstance()->current_test_info();
+    std::ostringstream name;
+    name << (test_info != nullptr ? test_info->name() : "sweep") << "[size=" << point.size;
+    if (point.baseline) {
+      name << ",baseline";
+    } else {
+      name << ",threads=" << point.threads;
+    }
+    name << ']';
+    auto record = ppc::core::MakePerfRecord(*perf_results, test_info != nullptr ? test_info->file() : "", name.str());
+    record.threads = point.threads;
+    record.processes = point.processes;
+    ppc::core::EmitPerfRecord(record);
+  }
+  return perf_results->stats.median;
+}
+
+void PrintTable(std::ostream& out, const char* title, const std::vector<ppc::core::SweepPoint>& points) {
+  out << title << '\n'
+      << std::setw(12) << "size" << std::setw(9) << "threads" << std::setw(7) << "procs" << std::setw(15)
+      << "time_sec" << std::setw(15) << "baseline_sec" << std::setw(10) << "speedup" << std::setw(12) << "efficiency"
+      << '\n';
+  for (const auto& point : points) {
+    out << std::setw(12) << point.size << std::setw(9) << point.threads << std::setw(7) << point.processes
+        << std::fixed << std::setprecision(9) << std::setw(15) << point.time_sec << std::setw(15)
+        << point.baseline_sec << std::setprecision(3) << std::setw(10) << point.speedup << std::setw(12)
+        << point.efficiency << '\n';
+  }
+}
+
+}  // namespace
+
+ppc::core::SweepResults ppc::core::RunSweep(const SweepConfig& config, const SweepFactory& parallel,
+                                            const SweepFactory& sequential) {
+  if (!parallel) {
+    throw std::invalid_argument("Sweep needs a parallel task factory");
+  }
+  const auto default_threads = ppc::util::GetPPCNumThreads();
+  const auto previous_threads = config.get_threads ? config.get_threads() : default_threads;
+  const auto threads = config.threads.empty() ? std::vector<int>{previous_threads} : config.threads;
+  const int processes = std::max(config.processes, 1);
+
+  auto run_parallel = [&](uint64_t size, int thread_count) {
+    if (config.set_threads) {
+      config.set_threads(thread_count);
+    }
+    return Measure(config, parallel(size), {size, thread_count, processes, false});
+  };
+  std::map<uint64_t, double> baselines;
+  auto baseline = [&](uint64_t size) {
+    auto it = baselines.find(size);
+    if (it != baselines.end()) {
+      return it->second;
+    }
+    auto time = sequential ? Measure(config, sequential(size), {size, 1, 1, true}) : run_parallel(size, 1);
+    return baselines.emplace(size, time).first->second;
+  };
+  auto make_point = [&](uint64_t size, int thread_count, double time, double baseline_time, bool weak) {
+    const double workers = static_cast<double>(thread_count) * processes;
+    SweepPoint point{.size = size, .threads = thread_count, .processes = processes, .time_sec = time,
+                     .baseline_sec = baseline_time};
+    if (time > 0.0) {
+      // weak scaling: the parallel run solves workers times more work than the baseline
+      point.speedup = (weak ? workers : 1.0) * baseline_time / time;
+      point.efficiency = point.speedup / workers;
+    }
+    return point;
+  };
+
+  SweepResults results;
+  for (auto size : config.sizes) {
+    const auto baseline_time = baseline(size);
+    for (auto thread_count : threads) {
+      results.strong.push_back(make_point(size, thread_count, run_parallel(size, thread_count), baseline_time, false));
+    }
+    for (auto thread_count : threads) {
+      const auto scaled_size = size * static_cast<uint64_t>(thread_count) * static_cast<uint64_t>(processes);
+      results.weak.push_back(
+          make_point(scaled_size, thread_count, run_parallel(scaled_size, thread_count), baseline_time, true));
+    }
+  }
+  if (config.set_threads) {
+    config.set_threads(previous_threads);
+  }
+  return results;
+}
+
+void ppc::core::PrintSweep(std::ostream& out, const SweepResults& results) {
+  std::ostringstream table;
+  PrintTable(table, "strong scaling", results.strong);
+  PrintTable(table, "weak scaling", results.weak);
+  out << table.str();
+}
+
+void ppc::core::WriteSweepCsv(std::ostream& out, const SweepResults& results) {
+  std::ostringstream csv;
+  csv << std::setprecision(10) << "scaling,size,threads,processes,time_sec,baseline_sec,speedup,efficiency\n";
+  for (const auto* points : {&results.strong, &results.weak}) {
+    for (const auto& point : *points) {
+      csv << (points == &results.strong ? "strong" : "weak") << ',' << point.size << ',' << point.threads << ','
+          << point.processes << ',' << point.time_sec << ',' << point.baseline_sec << ',' << point.speedup << ','
+          << point.efficiency << '\n';
+    }
+  }
+  out << csv.str();
+}
@@ -1,12 +1,32 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <coroutine>
 #include <cstddef>
 #include <cstdint>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <future>
 #include <memory>
+#include <mutex>
+#include <set>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <thread>
 #include <vector>
 
 #include "core/task/func_tests/test_task.hpp"
+#include "core/task/include/batch.hpp"
+#include "core/task/include/dataset.hpp"
+#include "core/task/include/partition.hpp"
 #include "core/task/include/task.hpp"
+#include "core/task/include/task_stream.hpp"
+#include "core/task/include/thread_pool.hpp"
 
 TEST(task_tests, check_int32_t) {
   // Create data
@@ -178,6 +198,528 @@ TEST(task_tests, check_wrong_order) {
   ASSERT_ANY_THROW(test_task.PostProcessing());
 }
 
+TEST(task_tests, check_typed_input_view) {
+  // Create data
+  std::vector<int32_t> in(20, 1);
+  std::vector<int32_t> out(1, 0);
+
+  // Create task_data
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->AddInput(in);
+  task_data->AddOutput(out);
+
+  auto view = task_data->GetInput<int32_t>(0);
+  ASSERT_EQ(view.data(), in.data());
+  ASSERT_EQ(view.size(), in.size());
+  EXPECT_EQ(task_data->inputs_count[0], in.size());
+  EXPECT_EQ(task_data->inputs_info[0].byte_size, in.size() * sizeof(int32_t));
+
+  // Create Task
+  ppc::test::task::TestTask<int32_t> test_task(task_data);
+  ASSERT_EQ(test_task.Validation(), true);
+  test_task.PreProcessing();
+  test_task.Run();
+  test_task.PostProcessing();
+  ASSERT_EQ(static_cast<size_t>(task_data->GetOutput<int32_t>(0)[0]), in.size());
+}
+
+TEST(task_tests, check_typed_input_view_wrong_type) {
+  std::vector<int32_t> in(20, 1);
+
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->AddInput(in);
+
+  ASSERT_ANY_THROW(auto view = task_data->GetInput<float>(0));
+  ASSERT_ANY_THROW(auto view = task_data->GetInput<int32_t>(1));
+}
+
+TEST(task_tests, check_untyped_input_view) {
+  std::vector<double> in(20, 1);
+  std::vector<double> extra(5, 2);
+
+  // inputs pushed directly are viewed with inputs_count elements
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
+  task_data->inputs_count.emplace_back(in.size());
+  task_data->AddInput(extra);
+
+  EXPECT_EQ(task_data->GetInput<double>(0).size(), in.size());
+  EXPECT_EQ(task_data->GetInput<double>(1).size(), extra.size());
+  ASSERT_ANY_THROW(auto view = task_data->GetInput<float>(1));
+}
+
+TEST(task_tests, check_input_view_owner_lifetime) {
+  auto in = std::make_shared<std::vector<int32_t>>(20, 1);
+
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->AddInput(in);
+  EXPECT_EQ(task_data->GetInput<int32_t>(0).size(), 20U);
+
+  in.reset();
+  ASSERT_ANY_THROW(auto view = task_data->GetInput<int32_t>(0));
+}
+
+TEST(task_tests, check_phase_stats) {
+  // Create data
+  std::vector<int32_t> in(20, 1);
+  std::vector<int32_t> out(1, 0);
+
+  // Create task_data
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->AddInput(in);
+  task_data->AddOutput(out);
+
+  // Create Task
+  ppc::test::task::FakeRegionTask<int32_t> test_task(task_data);
+  for (int i = 0; i < 2; i++) {
+    ASSERT_EQ(test_task.Validation(), true);
+    test_task.PreProcessing();
+    test_task.Run();
+    test_task.PostProcessing();
+  }
+
+  const auto &stats = test_task.GetStats();
+  EXPECT_EQ(stats.validation.calls, 2U);
+  EXPECT_EQ(stats.pre_processing.calls, 2U);
+  EXPECT_EQ(stats.run.calls, 2U);
+  EXPECT_EQ(stats.post_processing.calls, 2U);
+  ASSERT_EQ(stats.regions.size(), 2U);
+  EXPECT_EQ(stats.regions.at("sleep").calls, 2U);
+  EXPECT_GE(stats.regions.at("sleep").total_sec, 0.04);
+  EXPECT_GE(stats.run.total_sec, stats.regions.at("sleep").total_sec + stats.regions.at("compute").total_sec);
+  EXPECT_GE(stats.run.max_sec, stats.run.last_sec);
+
+  test_task.ResetStats();
+  EXPECT_EQ(test_task.GetStats().run.calls, 0U);
+  EXPECT_TRUE(test_task.GetStats().regions.empty());
+}
+
+TEST(task_tests, check_rebind_same_shape) {
+  // Create data
+  std::vector<int32_t> in(20, 1);
+  std::vector<int32_t> out(1, 0);
+  std::vector<int32_t> next_in(20, 2);
+  std::vector<int32_t> next_out(1, 0);
+
+  // Create task_data
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->AddInput(in);
+  task_data->AddOutput(out);
+  auto next_task_data = std::make_shared<ppc::core::TaskData>();
+  next_task_data->AddInput(next_in);
+  next_task_data->AddOutput(next_out);
+
+  // Create Task
+  ppc::test::task::TestTask<int32_t> test_task(task_data);
+  ASSERT_EQ(test_task.Validation(), true);
+  test_task.PreProcessing();
+  test_task.Run();
+  test_task.PostProcessing();
+  ASSERT_EQ(out[0], 20);
+
+  // the pipeline starts over on the new buffers
+  test_task.Rebind(next_task_data);
+  ASSERT_EQ(test_task.Validation(), true);
+  test_task.PreProcessing();
+  test_task.Run();
+  test_task.PostProcessing();
+  ASSERT_EQ(next_out[0], 40);
+  ASSERT_EQ(out[0], 20);
+}
+
+TEST(task_tests, check_rebind_other_shape) {
+  std::vector<int32_t> in(20, 1);
+  std::vector<int32_t> other_in(10, 1);
+  std::vector<int32_t> out(1, 0);
+
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->AddInput(in);
+  task_data->AddOutput(out);
+  auto other_task_data = std::make_shared<ppc::core::TaskData>();
+  other_task_data->AddInput(other_in);
+  other_task_data->AddOutput(out);
+
+  ppc::test::task::TestTask<int32_t> test_task(task_data);
+  EXPECT_FALSE(ppc::core::Task::SameShape(*task_data, *other_task_data));
+  EXPECT_THROW(test_task.Rebind(other_task_data), std::invalid_argument);
+  EXPECT_EQ(test_task.GetData(), task_data);
+}
+
+TEST(task_tests, check_task_memory_pool) {
+  // Create data
+  std::vector<int32_t> in(1000, 1);
+  std::vector<int32_t> out(1, 0);
+
+  // Create task_data
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->AddInput(in);
+  task_data->AddOutput(out);
+
+  // Create Task
+  ppc::test::task::PooledTempTask<int32_t> test_task(task_data);
+  for (int i = 0; i < 3; i++) {
+    ASSERT_EQ(test_task.Validation(), true);
+    test_task.PreProcessing();
+    test_task.Run();
+    test_task.PostProcessing();
+    ASSERT_EQ(out[0], 1000);
+  }
+
+  const auto &memory = test_task.GetStats().memory;
+  EXPECT_EQ(memory.allocations, 3000U);
+  EXPECT_EQ(memory.deallocations, 3000U);
+  EXPECT_EQ(memory.bytes, 3000U * 4 * sizeof(int32_t));
+  EXPECT_EQ(memory.peak_bytes, 4 * sizeof(int32_t));
+  // freed blocks are reused, so the system allocator is reached only by the first requests
+  EXPECT_LT(memory.upstream_allocations, 10U);
+
+  test_task.ResetStats();
+  EXPECT_EQ(test_task.GetStats().memory.allocations, 0U);
+}
+
+TEST(task_tests, check_run_batch) {
+  std::vector<std::vector<int32_t>> in = {std::vector<int32_t>(3, 1), std::vector<int32_t>(5, 2), {}};
+  std::vector<std::vector<int32_t>> out = {{0}, {0}, {0, 0}};
+
+  std::vector<ppc::core::TaskDataPtr> batch;
+  for (std::size_t i = 0; i < in.size(); i++) {
+    auto task_data = std::make_shared<ppc::core::TaskData>();
+    task_data->AddInput(in[i]);
+    task_data->AddOutput(out[i]);
+    batch.push_back(task_data);
+  }
+
+  ppc::test::task::TestTask<int32_t> test_task(batch.front());
+  auto results = test_task.RunBatch(batch);
+  // the last item has two outputs and fails validation
+  EXPECT_EQ(results, std::vector<bool>({true, true, false}));
+  EXPECT_EQ(out[0][0], 3);
+  EXPECT_EQ(out[1][0], 10);
+  EXPECT_EQ(test_task.GetData(), batch.back());
+  EXPECT_EQ(test_task.GetStats().run.calls, 2U);
+  EXPECT_EQ(test_task.GetStats().regions.at("batch").calls, 1U);
+  EXPECT_THROW(test_task.RunBatch({nullptr}), std::invalid_argument);
+
+  ppc::core::PackedBatch<int32_t> packed;
+  for (const auto &values : in) {
+    packed.values.insert(packed.values.end(), values.begin(), values.end());
+    packed.offsets.push_back(packed.values.size());
+  }
+  ASSERT_EQ(packed.Items(), 3U);
+  EXPECT_EQ(packed.values.size(), 8U);
+  EXPECT_EQ(packed.Item(1).size(), 5U);
+  EXPECT_EQ(packed.Item(1)[0], 2);
+  EXPECT_TRUE(packed.Item(2).empty());
+}
+
+TEST(task_tests, check_partition) {
+  auto rows = ppc::core::Partition::Rows(10, 4, 3);
+  EXPECT_EQ(rows.GlobalCount(), 40U);
+  EXPECT_EQ(rows.Rows(0), 4U);
+  EXPECT_EQ(rows.Rows(2), 3U);
+  EXPECT_EQ(rows.Offset(1), 16U);
+  EXPECT_EQ(rows.FirstRow(2), 7U);
+  EXPECT_EQ(rows.RowOwner(3), 0);
+  EXPECT_EQ(rows.RowOwner(4), 1);
+  EXPECT_EQ(rows.RowOwner(9), 2);
+  EXPECT_THROW((void)rows.RowOwner(10), std::out_of_range);
+
+  // empty parts own no rows
+  auto sparse = ppc::core::Partition::FromCounts({0, 6, 0, 2}, 2);
+  EXPECT_EQ(sparse.RowOwner(0), 1);
+  EXPECT_EQ(sparse.RowOwner(3), 3);
+  EXPECT_EQ(ppc::core::Partition::Block(5, 2), ppc::core::Partition::FromCounts({3, 2}));
+  EXPECT_THROW(ppc::core::Partition::FromCounts({3, 2}, 2), std::invalid_argument);
+
+  std::vector<int32_t> local(rows.Count(1));
+  auto partition = std::make_shared<const ppc::core::Partition>(rows);
+  ppc::core::TaskData task_data;
+  task_data.AddDistributedInput(local.data(), partition, 1);
+  task_data.AddOutput(local);
+  EXPECT_EQ(task_data.GetInput<int32_t>(0).size(), 12U);
+  EXPECT_EQ(task_data.InputPartition(0), partition.get());
+  EXPECT_EQ(task_data.OutputPartition(0), nullptr);
+  EXPECT_EQ(task_data.InputPartition(1), nullptr);
+}
+
+namespace {
+
+// Minimal eagerly started coroutine for awaiting stream handles
+struct Detached {
+  struct promise_type {  // NOLINT(readability-identifier-naming)
+    Detached get_return_object() { return {}; }  // NOLINT(readability-identifier-naming)
+    std::suspend_never initial_suspend() noexcept { return {}; }  // NOLINT(readability-identifier-naming)
+    std::suspend_never final_suspend() noexcept { return {}; }  // NOLINT(readability-identifier-naming)
+    void return_void() {}  // NOLINT(readability-identifier-naming)
+    void unhandled_exception() { std::terminate(); }  // NOLINT(readability-identifier-naming)
+  };
+};
+
+Detached AwaitTask(ppc::core::TaskHandle handle, std::promise<bool> &result) {
+  const bool ok = co_await handle;
+  result.set_value(ok);
+}
+
+// waits for and destroys the stream after the awaited task
+Detached AwaitAndDestroy(std::unique_ptr<ppc::core::TaskStream> stream, ppc::core::TaskHandle handle,
+                         std::promise<bool> &result) {
+  const bool ok = co_await handle;
+  stream->Wait();
+  stream.reset();
+  result.set_value(ok);
+}
+
+}  // namespace
+
+TEST(task_tests, check_task_stream) {
+  constexpr int kTasks = 4;
+  std::vector<std::vector<int32_t>> in(kTasks);
+  std::vector<std::vector<int32_t>> out(kTasks, std::vector<int32_t>(1, 0));
+  std::vector<ppc::core::TaskHandle> handles;
+
+  ppc::core::TaskStream stream;
+  for (int i = 0; i < kTasks; i++) {
+    in[i].assign(10 * (i + 1), 1);
+    auto task_data = std::make_shared<ppc::core::TaskData>();
+    task_data->AddInput(in[i]);
+    task_data->AddOutput(out[i]);
+    handles.push_back(stream.Submit(std::make_shared<ppc::test::task::TestTask<int32_t>>(task_data)));
+  }
+  stream.Wait();
+
+  for (int i = 0; i < kTasks; i++) {
+    EXPECT_TRUE(handles[i].Ready());
+    EXPECT_TRUE(handles[i].Get());
+    EXPECT_EQ(out[i][0], 10 * (i + 1));
+  }
+}
+
+TEST(task_tests, check_task_stream_overlaps_phases) {
+  constexpr int kTasks = 6;
+  constexpr auto kStageTime = std::chrono::milliseconds(30);
+  std::vector<int32_t> in(10, 1);
+  std::vector<std::vector<int32_t>> out(kTasks, std::vector<int32_t>(1, 0));
+
+  const auto start = std::chrono::steady_clock::now();
+  {
+    ppc::core::TaskStream stream;
+    for (int i = 0; i < kTasks; i++) {
+      auto task_data = std::make_shared<ppc::core::TaskData>();
+      task_data->AddInput(in);
+      task_data->AddOutput(out[i]);
+      stream.Submit(std::make_shared<ppc::test::task::FakeStageTask<int32_t>>(task_data, kStageTime));
+    }
+  }
+  const auto elapsed = std::chrono::steady_clock::now() - start;
+
+  // serial execution takes kTasks * 3 stages, the pipeline about kTasks + 2
+  EXPECT_LT(elapsed, kStageTime * kTasks * 3 * 3 / 4);
+  for (const auto &value : out) {
+    EXPECT_EQ(value[0], 10);
+  }
+}
+
+TEST(task_tests, check_task_stream_time_budget_excludes_queueing) {
+  // the runs of all tasks together exceed the 1 s budget of a functional test, one run does not
+  constexpr int kTasks = 6;
+  constexpr auto kRunTime = std::chrono::milliseconds(250);
+  std::vector<int32_t> in(10, 1);
+  std::vector<std::vector<int32_t>> out(kTasks, std::vector<int32_t>(1, 0));
+  std::vector<ppc::core::TaskHandle> handles;
+
+  ppc::core::TaskStream stream;
+  for (int i = 0; i < kTasks; i++) {
+    auto task_data = std::make_shared<ppc::core::TaskData>();
+    task_data->AddInput(in);
+    task_data->AddOutput(out[i]);
+    handles.push_back(stream.Submit(std::make_shared<ppc::test::task::FakeSlowRunTask<int32_t>>(task_data, kRunTime)));
+  }
+  for (auto &handle : handles) {
+    EXPECT_TRUE(handle.Get());
+  }
+}
+
+TEST(task_tests, check_task_stream_errors) {
+  std::vector<int32_t> in(10, 1);
+  std::vector<int32_t> out(1, 0);
+  std::vector<int32_t> wrong_out(2, 0);
+
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->AddInput(in);
+  task_data->AddOutput(out);
+  auto wrong_task_data = std::make_shared<ppc::core::TaskData>();
+  wrong_task_data->AddInput(in);
+  wrong_task_data->AddOutput(wrong_out);
+
+  ppc::core::TaskStream stream;
+  auto throwing = stream.Submit(std::make_shared<ppc::test::task::FakeThrowingTask<int32_t>>(task_data));
+  auto invalid = stream.Submit(std::make_shared<ppc::test::task::TestTask<int32_t>>(wrong_task_data));
+  EXPECT_THROW((void)throwing.Get(), std::runtime_error);
+  EXPECT_FALSE(invalid.Get());
+  EXPECT_THROW(stream.Submit(nullptr), std::invalid_argument);
+}
+
+TEST(task_tests, check_task_stream_co_await) {
+  std::vector<int32_t> in(10, 1);
+  std::vector<int32_t> out(1, 0);
+
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->AddInput(in);
+  task_data->AddOutput(out);
+
+  std::promise<bool> result;
+  auto awaited = result.get_future();
+  ppc::core::TaskStream stream;
+  AwaitTask(stream.Submit(std::make_shared<ppc::test::task::FakeStageTask<int32_t>>(task_data,
+                                                                                    std::chrono::milliseconds(10))),
+            result);
+  EXPECT_TRUE(awaited.get());
+  EXPECT_EQ(out[0], 10);
+}
+
+TEST(task_tests, check_task_stream_co_await_destroys_stream) {
+  std::vector<int32_t> in(10, 1);
+  std::vector<int32_t> out(2, 0);
+
+  std::promise<bool> result;
+  auto awaited = result.get_future();
+  auto stream = std::make_unique<ppc::core::TaskStream>();
+  std::vector<ppc::core::TaskHandle> handles;
+  for (auto &value : out) {
+    auto task_data = std::make_shared<ppc::core::TaskData>();
+    task_data->AddInput(in);
+    task_data->AddOutput(&value, 1);
+    handles.push_back(stream->Submit(
+        std::make_shared<ppc::test::task::FakeStageTask<int32_t>>(task_data, std::chrono::milliseconds(10))));
+  }
+  AwaitAndDestroy(std::move(stream), handles.front(), result);
+  ASSERT_EQ(awaited.wait_for(std::chrono::seconds(10)), std::future_status::ready);
+  EXPECT_TRUE(awaited.get());
+  EXPECT_TRUE(handles.back().Ready());
+  EXPECT_EQ(out, std::vector<int32_t>(2, 10));
+}
+
+TEST(task_tests, check_thread_pool) {
+  ppc::core::ThreadPool pool(4);
+  ASSERT_EQ(pool.Size(), 4);
+
+  std::vector<int> hits(1003, 0);
+  pool.ParallelFor(3, hits.size(), [&](std::size_t begin, std::size_t end) {
+    for (auto i = begin; i < end; i++) {
+      hits[i]++;
+    }
+  });
+  EXPECT_EQ(std::count(hits.begin(), hits.begin() + 3, 0), 3);
+  EXPECT_EQ(std::count(hits.begin() + 3, hits.end(), 1), 1000);
+
+  // jobs that submit more jobs to the same group, unevenly sized so that workers steal
+  std::atomic<int> leaves = 0;
+  std::set<std::thread::id> threads;
+  std::mutex threads_mutex;
+  ppc::core::ThreadPool::Group group;
+  std::function<void(int)> split = [&](int depth) {
+    {
+      const std::lock_guard lock(threads_mutex);
+      threads.insert(std::this_thread::get_id());
+    }
+    if (depth == 0) {
+      std::this_thread::sleep_for(std::chrono::microseconds(50));
+      leaves++;
+      return;
+    }
+    pool.Submit(group, [&, depth] { split(depth - 1); });
+    pool.Submit(group, [&, depth] { split(depth - 1); });
+  };
+  pool.Submit(group, [&] { split(8); });
+  pool.Wait(group);
+  EXPECT_EQ(leaves, 256);
+  EXPECT_GT(threads.size(), 1U);
+
+  auto failing = [](std::size_t begin, std::size_t) {
+    if (begin == 2) {
+      throw std::runtime_error("job failed");
+    }
+  };
+  EXPECT_THROW(pool.ParallelFor(0, 10, failing, 1), std::runtime_error);
+  // the pool stays usable after a failed job
+  int calls = 0;
+  pool.ParallelFor(0, 1, [&](std::size_t, std::size_t) { calls++; });
+  EXPECT_EQ(calls, 1);
+  EXPECT_THROW(ppc::core::ThreadPool(0), std::invalid_argument);
+}
+
+TEST(task_tests, check_thread_pool_single_thread) {
+  // without workers the waiting thread runs every job
+  ppc::core::ThreadPool pool(1);
+  ppc::core::ThreadPool::Group group;
+  int sum = 0;
+  for (int i = 1; i <= 10; i++) {
+    pool.Submit(group, [&sum, i] { sum += i; });
+  }
+  pool.Wait(group);
+  EXPECT_EQ(sum, 55);
+}
+
+TEST(task_tests, check_dataset) {
+  const auto path = (std::filesystem::temp_directory_path() / "ppc_check_dataset.bin").string();
+  std::vector<int32_t> values(6 * 4);
+  for (std::size_t i = 0; i < values.size(); i++) {
+    values[i] = static_cast<int32_t>(i * 3);
+  }
+  ppc::core::Dataset::Write(path, std::span<const int32_t>(values), {6, 4});
+
+  auto dataset = ppc::core::Dataset::Open(path);
+  EXPECT_EQ(dataset->Type(), ppc::core::DType::kInt32);
+  EXPECT_EQ(dataset->GetLayout(), ppc::core::Layout::kRowMajor);
+  EXPECT_EQ(dataset->Shape(), (std::vector<uint64_t>{6, 4}));
+  auto mapped = dataset->Values<int32_t>();
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(mapped.data()) % ppc::core::Dataset::kAlignment, 0U);
+  EXPECT_EQ(std::vector<int32_t>(mapped.begin(), mapped.end()), values);
+  EXPECT_THROW((void)dataset->Values<float>(), std::invalid_argument);
+
+  // the task reads the mapping itself, no copy is made
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  dataset->AddAsInput<int32_t>(*task_data);
+  EXPECT_EQ(task_data->inputs_count[0], values.size());
+  EXPECT_EQ(task_data->GetInput<int32_t>(0).data(), mapped.data());
+  dataset.reset();
+  EXPECT_THROW((void)task_data->GetInput<int32_t>(0), std::runtime_error);
+
+  EXPECT_THROW(ppc::core::Dataset::Write(path, std::span<const int32_t>(values), {5, 4}), std::invalid_argument);
+  {
+    // a file from a newer version of the format
+    std::fstream file(path, std::ios::in | std::ios::out | std::ios::binary);
+    file.seekp(8);
+    const uint32_t version = ppc::core::Dataset::kVersion + 1;
+    file.write(reinterpret_cast<const char *>(&version), sizeof(version));
+  }
+  EXPECT_THROW((void)ppc::core::Dataset::Open(path), std::runtime_error);
+  {
+    // a dtype this build does not know
+    const int32_t value = 1;
+    ppc::core::Dataset::Write(path, std::span<const int32_t>(&value, 1), {1});
+    std::fstream file(path, std::ios::in | std::ios::out | std::ios::binary);
+    file.seekp(12);
+    const uint8_t dtype = 0xFF;
+    file.write(reinterpret_cast<const char *>(&dtype), sizeof(dtype));
+  }
+  EXPECT_THROW((void)ppc::core::Dataset::Open(path), std::runtime_error);
+  {
+    // (2^62 + 1) * 4 bytes wraps around to the 4 bytes of the payload
+    const int32_t value = 1;
+    ppc::core::Dataset::Write(path, std::span<const int32_t>(&value, 1), {1});
+    std::fstream file(path, std::ios::in | std::ios::out | std::ios::binary);
+    file.seekp(16);
+    const uint64_t rows = (uint64_t{1} << 62) + 1;
+    file.write(reinterpret_cast<const char *>(&rows), sizeof(rows));
+  }
+  EXPECT_THROW((void)ppc::core::Dataset::Open(path), std::runtime_error);
+  std::filesystem::resize_file(path, 100);
+  EXPECT_THROW((void)ppc::core::Dataset::Open(path), std::runtime_error);
+  std::filesystem::remove(path);
+  EXPECT_THROW((void)ppc::core::Dataset::Open(path), std::runtime_error);
+}
+
 int main(int argc, char **argv) {
   testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();
@@ -1,6 +1,8 @@
 #pragma once
 
 #include <chrono>
+#include <memory_resource>
+#include <stdexcept>
 #include <thread>
 #include <vector>
 
@@ -46,4 +48,86 @@ class FakeSlowTask : public TestTask<T> {
   }
 };
 
+template <class T>
+class FakeRegionTask : public TestTask<T> {
+ public:
+  explicit FakeRegionTask(ppc::core::TaskDataPtr task_data) : TestTask<T>(task_data) {}
+
+  bool RunImpl() override {
+    {
+      auto region = this->MeasureRegion("sleep");
+      std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    }
+    auto region = this->MeasureRegion("compute");
+    return TestTask<T>::RunImpl();
+  }
+};
+
+// Sums the input through a short-lived buffer per element
+template <class T>
+class PooledTempTask : public TestTask<T> {
+ public:
+  explicit PooledTempTask(ppc::core::TaskDataPtr task_data) : TestTask<T>(task_data) {}
+
+  bool RunImpl() override {
+    auto input = this->task_data->template GetInput<T>(0);
+    auto *output = reinterpret_cast<T *>(this->task_data->outputs[0]);
+    for (const auto &value : input) {
+      std::pmr::vector<T> tmp(this->Memory());
+      tmp.assign(4, value);
+      output[0] += tmp[0];
+    }
+    return true;
+  }
+};
+
+// Every phase takes the given time, so a pipelined run can be told from a serial one
+template <class T>
+class FakeStageTask : public TestTask<T> {
+ public:
+  FakeStageTask(ppc::core::TaskDataPtr task_data, std::chrono::milliseconds stage_time)
+      : TestTask<T>(task_data), stage_time_(stage_time) {}
+
+  bool PreProcessingImpl() override {
+    std::this_thread::sleep_for(stage_time_);
+    return TestTask<T>::PreProcessingImpl();
+  }
+
+  bool RunImpl() override {
+    std::this_thread::sleep_for(stage_time_);
+    return TestTask<T>::RunImpl();
+  }
+
+  bool PostProcessingImpl() override {
+    std::this_thread::sleep_for(stage_time_);
+    return TestTask<T>::PostProcessingImpl();
+  }
+
+ private:
+  std::chrono::milliseconds stage_time_;
+};
+
+template <class T>
+class FakeSlowRunTask : public TestTask<T> {
+ public:
+  FakeSlowRunTask(ppc::core::TaskDataPtr task_data, std::chrono::milliseconds run_time)
+      : TestTask<T>(task_data), run_time_(run_time) {}
+
+  bool RunImpl() override {
+    std::this_thread::sleep_for(run_time_);
+    return TestTask<T>::RunImpl();
+  }
+
+ private:
+  std::chrono::milliseconds run_time_;
+};
+
+template <class T>
+class FakeThrowingTask : public TestTask<T> {
+ public:
+  explicit FakeThrowingTask(ppc::core::TaskDataPtr task_data) : TestTask<T>(task_data) {}
+
+  bool RunImpl() override { throw std::runtime_error("run failed"); }
+};
+
 }  // namespace ppc::test::task
@@ -0,0 +1,22 @@
+#pragma once
+
+#include <cstddef>
+#include <span>
+#include <vector>
+
+namespace ppc::core {
+
+// Inputs of a batch laid out back to back, e.g. to send the whole batch with a single collective instead of
+// one per item: item i occupies values[offsets[i], offsets[i + 1])
+template <class T>
+struct PackedBatch {
+  std::vector<T> values;
+  std::vector<std::size_t> offsets{0};
+
+  [[nodiscard]] std::size_t Items() const { return offsets.size() - 1; }
+  [[nodiscard]] std::span<const T> Item(std::size_t index) const {
+    return std::span<const T>(values).subspan(offsets[index], offsets[index + 1] - offsets[index]);
+  }
+};
+
+}  // namespace ppc::core
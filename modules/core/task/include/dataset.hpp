@@ -0,0 +1,124 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "core/task/include/task.hpp"
+#include "core/util/include/mapped_file.hpp"
+
+namespace ppc::core {
+
+enum class DType : uint8_t { kUInt8 = 1, kInt8, kUInt16, kInt16, kUInt32, kInt32, kUInt64, kInt64, kFloat32, kFloat64 };
+
+// order of the elements of a multi-dimensional dataset
+enum class Layout : uint8_t { kRowMajor = 1, kColMajor };
+
+std::size_t DTypeSize(DType dtype);
+std::string DTypeName(DType dtype);
+
+template <class T>
+constexpr DType DTypeOf() {
+  using U = std::remove_const_t<T>;
+  static_assert(std::is_arithmetic_v<U> && !std::is_same_v<U, bool>, "datasets hold integers or floating point");
+  if constexpr (std::is_floating_point_v<U>) {
+    static_assert(sizeof(U) == 4 || sizeof(U) == 8);
+    return sizeof(U) == 4 ? DType::kFloat32 : DType::kFloat64;
+  } else {
+    constexpr bool kSigned = std::is_signed_v<U>;
+    switch (sizeof(U)) {
+      case 1:
+        return kSigned ? DType::kInt8 : DType::kUInt8;
+      case 2:
+        return kSigned ? DType::kInt16 : DType::kUInt16;
+      case 4:
+        return kSigned ? DType::kInt32 : DType::kUInt32;
+      default:
+        return kSigned ? DType::kInt64 : DType::kUInt64;
+    }
+  }
+}
+
+// Binary container for large task inputs that is memory-mapped instead of parsed:
+//
+//   offset  size  field
+//        0     8  magic "PPCDSET\0"
+//        8     4  format version
+//       12     1  dtype
+//       13     1  layout
+//       14     2  rank (count of dimensions, at most kMaxRank)
+//       16    64  shape, kMaxRank uint64 values, unused ones are 0
+//       80     8  payload offset, a multiple of kAlignment
+//       88     8  payload size in bytes
+//       96    32  reserved
+//
+// Numbers are little-endian. Readers reject newer versions and use the stored payload offset, so later
+// versions may extend the header. The payload is mapped with private copy-on-write pages: tasks may modify
+// it in place, the file does not change.
+class Dataset : public std::enable_shared_from_this<Dataset> {
+ public:
+  static constexpr uint32_t kVersion = 1;
+  static constexpr std::size_t kAlignment = 64;
+  static constexpr std::size_t kMaxRank = 8;
+
+  // throws std::runtime_error if the file is missing, not a dataset, of a newer version, corrupt or truncated
+  static std::shared_ptr<Dataset> Open(const std::string &path);
+  // throws std::invalid_argument on a bad shape and std::runtime_error if the file cannot be written
+  static void Write(const std::string &path, DType dtype, const std::vector<uint64_t> &shape, const void *data,
+                    Layout layout = Layout::kRowMajor);
+  template <class T>
+  static void Write(const std::string &path, std::span<const T> values, const std::vector<uint64_t> &shape,
+                    Layout layout = Layout::kRowMajor) {
+    uint64_t count = 1;
+    for (auto dim : shape) {
+      count *= dim;
+    }
+    if (count != values.size()) {
+      throw std::invalid_argument("Dataset: shape does not match the count of values");
+    }
+    Write(path, DTypeOf<T>(), shape, values.data(), layout);
+  }
+
+  [[nodiscard]] DType Type() const { return dtype_; }
+  [[nodiscard]] Layout GetLayout() const { return layout_; }
+  [[nodiscard]] const std::vector<uint64_t> &Shape() const { return shape_; }
+  // count of elements
+  [[nodiscard]] uint64_t Count() const { return count_; }
+
+  // throws std::invalid_argument if T does not match the stored dtype
+  template <class T>
+  [[nodiscard]] std::span<T> Values() const {
+    if (DTypeOf<T>() != dtype_) {
+      throw std::invalid_argument("Dataset: stored " + DTypeName(dtype_) + " is read as " + DTypeName(DTypeOf<T>()));
+    }
+    return {reinterpret_cast<T *>(payload_), count_};
+  }
+
+  // register the payload as a typed input of task_data; the view stays valid while the dataset lives
+  template <class T>
+  void AddAsInput(TaskData &task_data) {
+    auto values = Values<T>();
+    if (values.size() > std::numeric_limits<std::uint32_t>::max()) {
+      throw std::invalid_argument("Dataset: too many elements for TaskData::inputs_count");
+    }
+    task_data.AddInput(values.data(), values.size(), std::shared_ptr<const void>(shared_from_this()));
+  }
+
+ private:
+  Dataset() = default;
+
+  ppc::util::MappedFile file_;
+  std::byte *payload_ = nullptr;
+  DType dtype_ = DType::kUInt8;
+  Layout layout_ = Layout::kRowMajor;
+  std::vector<uint64_t> shape_;
+  uint64_t count_ = 0;
+};
+
+}  // namespace ppc::core
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+
+namespace ppc::core {
+
+struct TaskMemoryStats {
+  // requests made by the task
+  uint64_t allocations = 0;
+  uint64_t deallocations = 0;
+  uint64_t bytes = 0;
+  // highest amount of requested memory alive at the same time
+  uint64_t peak_bytes = 0;
+  // requests the pool passed on to the system allocator
+  uint64_t upstream_allocations = 0;
+  uint64_t upstream_bytes = 0;
+};
+
+// Forwards to an upstream resource and counts the traffic
+class CountingResource : public std::pmr::memory_resource {
+ public:
+  explicit CountingResource(std::pmr::memory_resource *upstream = std::pmr::new_delete_resource())
+      : upstream_(upstream) {}
+
+  [[nodiscard]] uint64_t Allocations() const { return allocations_; }
+  [[nodiscard]] uint64_t Deallocations() const { return deallocations_; }
+  [[nodiscard]] uint64_t Bytes() const { return bytes_; }
+  [[nodiscard]] uint64_t PeakBytes() const { return peak_bytes_; }
+  // start counting anew; memory alive now remains the base of the peak
+  void ResetCounters();
+
+ private:
+  void *do_allocate(std::size_t bytes, std::size_t alignment) override;
+  void do_deallocate(void *p, std::size_t bytes, std::size_t alignment) override;
+  [[nodiscard]] bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override;
+
+  std::pmr::memory_resource *upstream_;
+  uint64_t allocations_ = 0;
+  uint64_t deallocations_ = 0;
+  uint64_t bytes_ = 0;
+  uint64_t live_bytes_ = 0;
+  uint64_t peak_bytes_ = 0;
+};
+
+// Memory for task internals: freed blocks are kept in pools and reused by the next requests of the same size,
+// so short-lived containers in hot loops stop reaching malloc after the first iterations.
+// Not thread-safe: use it from the thread that runs the task.
+class TaskMemory {
+ public:
+  TaskMemory() : pool_(&upstream_), requests_(&pool_) {}
+  TaskMemory(const TaskMemory &) = delete;
+  TaskMemory &operator=(const TaskMemory &) = delete;
+  TaskMemory(TaskMemory &&) = delete;
+  TaskMemory &operator=(TaskMemory &&) = delete;
+  ~TaskMemory() = default;
+
+  [[nodiscard]] std::pmr::memory_resource *Resource() { return &requests_; }
+  [[nodiscard]] TaskMemoryStats Stats() const;
+  void ResetStats();
+
+ private:
+  CountingResource upstream_;
+  std::pmr::unsynchronized_pool_resource pool_;
+  CountingResource requests_;
+};
+
+}  // namespace ppc::core
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace ppc::core {
+
+// Layout of a buffer split across processes into blocks of whole rows: process p owns the elements
+// [Offset(p), Offset(p) + Count(p)) of the global buffer. A plain block partition has rows of one element.
+class Partition {
+ public:
+  // split as evenly as possible, the first processes get one row more
+  static Partition Block(uint64_t count, int parts);
+  static Partition Rows(uint64_t rows, uint64_t row_size, int parts);
+  // counts in elements, each a multiple of row_size
+  static Partition FromCounts(const std::vector<uint64_t> &counts, uint64_t row_size = 1);
+
+  [[nodiscard]] int Parts() const { return static_cast<int>(counts_.size()); }
+  [[nodiscard]] uint64_t Count(int part) const { return counts_.at(part); }
+  [[nodiscard]] uint64_t Offset(int part) const { return offsets_.at(part); }
+  [[nodiscard]] uint64_t GlobalCount() const { return offsets_.back(); }
+  [[nodiscard]] uint64_t RowSize() const { return row_size_; }
+  [[nodiscard]] uint64_t Rows() const { return GlobalCount() / row_size_; }
+  [[nodiscard]] uint64_t Rows(int part) const { return Count(part) / row_size_; }
+  [[nodiscard]] uint64_t FirstRow(int part) const { return Offset(part) / row_size_; }
+  // process that owns a global row
+  [[nodiscard]] int RowOwner(uint64_t row) const;
+
+  bool operator==(const Partition &other) const = default;
+
+ private:
+  Partition(std::vector<uint64_t> counts, uint64_t row_size);
+
+  std::vector<uint64_t> counts_;
+  // offsets_[p] is the first element of process p, offsets_.back() the global count
+  std::vector<uint64_t> offsets_;
+  uint64_t row_size_;
+};
+
+}  // namespace ppc::core
@@ -1,23 +1,185 @@
 #pragma once
 
 #include <chrono>
+#include <cstddef>
 #include <cstdint>
+#include <functional>
+#include <map>
 #include <memory>
+#include <memory_resource>
+#include <span>
+#include <stdexcept>
 #include <string>
+#include <string_view>
+#include <type_traits>
+#include <typeinfo>
+#include <utility>
 #include <vector>
 
+#include "core/task/include/memory_resource.hpp"
+#include "core/task/include/partition.hpp"
+
 namespace ppc::core {
 
+// Description of a buffer registered through TaskData::AddInput/AddOutput
+struct BufferInfo {
+  const std::type_info *type = nullptr;
+  std::size_t elem_size = 0;
+  std::size_t byte_size = 0;
+  // set only for buffers registered with a shared owner
+  std::weak_ptr<const void> owner;
+  bool tracked = false;
+  // set for the local part of a buffer distributed across processes
+  std::shared_ptr<const Partition> partition = nullptr;
+};
+
 struct TaskData {
   std::vector<uint8_t *> inputs;
   std::vector<std::uint32_t> inputs_count;
   std::vector<uint8_t *> outputs;
   std::vector<std::uint32_t> outputs_count;
   enum StateOfTesting : uint8_t { kFunc, kPerf } state_of_testing;
+
+  // Typed descriptions of inputs/outputs (empty entries for buffers pushed directly into inputs/outputs)
+  std::vector<BufferInfo> inputs_info;
+  std::vector<BufferInfo> outputs_info;
+
+  // register buffers with element type and byte size
+  template <class T>
+  void AddInput(T *data, std::size_t count) {
+    AddBuffer(inputs, inputs_count, inputs_info, data, count, {});
+  }
+  template <class T>
+  void AddInput(std::vector<T> &data) {
+    AddInput(data.data(), data.size());
+  }
+  // the view is rejected if the owner is destroyed before the task reads it
+  template <class T>
+  void AddInput(const std::shared_ptr<std::vector<T>> &data) {
+    AddBuffer(inputs, inputs_count, inputs_info, data->data(), data->size(), data);
+  }
+  // buffer that stays valid while `owner` lives, e.g. a memory-mapped dataset
+  template <class T>
+  void AddInput(T *data, std::size_t count, const std::shared_ptr<const void> &owner) {
+    AddBuffer(inputs, inputs_count, inputs_info, data, count, owner);
+  }
+  template <class T>
+  void AddOutput(T *data, std::size_t count) {
+    AddBuffer(outputs, outputs_count, outputs_info, data, count, {});
+  }
+  template <class T>
+  void AddOutput(std::vector<T> &data) {
+    AddOutput(data.data(), data.size());
+  }
+  template <class T>
+  void AddOutput(const std::shared_ptr<std::vector<T>> &data) {
+    AddBuffer(outputs, outputs_count, outputs_info, data->data(), data->size(), data);
+  }
+
+  // register the part of a distributed buffer owned by process `rank`, data holds partition->Count(rank) elements
+  template <class T>
+  void AddDistributedInput(T *data, const std::shared_ptr<const Partition> &partition, int rank) {
+    AddBuffer(inputs, inputs_count, inputs_info, data, partition->Count(rank), {});
+    inputs_info.back().partition = partition;
+  }
+  template <class T>
+  void AddDistributedOutput(T *data, const std::shared_ptr<const Partition> &partition, int rank) {
+    AddBuffer(outputs, outputs_count, outputs_info, data, partition->Count(rank), {});
+    outputs_info.back().partition = partition;
+  }
+  // layout of a distributed buffer, nullptr for buffers held whole by one process
+  [[nodiscard]] const Partition *InputPartition(std::size_t index) const {
+    return index < inputs_info.size() ? inputs_info[index].partition.get() : nullptr;
+  }
+  [[nodiscard]] const Partition *OutputPartition(std::size_t index) const {
+    return index < outputs_info.size() ? outputs_info[index].partition.get() : nullptr;
+  }
+
+  // Zero-copy views of inputs/outputs. Registered buffers are checked against the requested element type
+  // and the owner lifetime; untyped buffers are viewed as inputs_count[index] elements of T.
+  template <class T>
+  [[nodiscard]] std::span<const T> GetInput(std::size_t index) const {
+    return View<const T>(inputs, inputs_count, inputs_info, index);
+  }
+  template <class T>
+  [[nodiscard]] std::span<T> GetOutput(std::size_t index) const {
+    return View<T>(outputs, outputs_count, outputs_info, index);
+  }
+
+ private:
+  template <class T>
+  static void AddBuffer(std::vector<uint8_t *> &ptrs, std::vector<std::uint32_t> &counts,
+                        std::vector<BufferInfo> &infos, T *data, std::size_t count,
+                        const std::shared_ptr<const void> &owner) {
+    infos.resize(ptrs.size());
+    ptrs.emplace_back(reinterpret_cast<uint8_t *>(const_cast<std::remove_const_t<T> *>(data)));
+    counts.emplace_back(static_cast<std::uint32_t>(count));
+    BufferInfo info{.type = &typeid(std::remove_const_t<T>),
+                    .elem_size = sizeof(T),
+                    .byte_size = count * sizeof(T),
+                    .owner = owner,
+                    .tracked = owner != nullptr};
+    infos.emplace_back(std::move(info));
+  }
+
+  template <class T>
+  static std::span<T> View(const std::vector<uint8_t *> &ptrs, const std::vector<std::uint32_t> &counts,
+                           const std::vector<BufferInfo> &infos, std::size_t index) {
+    if (index >= ptrs.size()) {
+      throw std::out_of_range("TaskData: buffer index " + std::to_string(index) + " is out of range");
+    }
+    auto *data = reinterpret_cast<T *>(ptrs[index]);
+    if (index >= infos.size() || infos[index].type == nullptr) {
+      return {data, index < counts.size() ? counts[index] : 0};
+    }
+    const auto &info = infos[index];
+    if (*info.type != typeid(std::remove_const_t<T>)) {
+      throw std::invalid_argument("TaskData: buffer " + std::to_string(index) + " holds " + info.type->name() +
+                                  ", requested " + typeid(std::remove_const_t<T>).name());
+    }
+    if (info.tracked && info.owner.expired()) {
+      throw std::runtime_error("TaskData: owner of buffer " + std::to_string(index) + " was destroyed");
+    }
+    return {data, info.byte_size / info.elem_size};
+  }
 };
 
 using TaskDataPtr = std::shared_ptr<ppc::core::TaskData>;
 
+// Accumulated time of a pipeline phase or of a named region inside a task (in seconds)
+struct TaskTimer {
+  uint64_t calls = 0;
+  double total_sec = 0.0;
+  double last_sec = 0.0;
+  double max_sec = 0.0;
+};
+
+struct TaskStats {
+  TaskTimer validation;
+  TaskTimer pre_processing;
+  TaskTimer run;
+  TaskTimer post_processing;
+  // regions marked with Task::MeasureRegion
+  std::map<std::string, TaskTimer, std::less<>> regions;
+  // traffic of Task::Memory()
+  TaskMemoryStats memory;
+};
+
+// Adds the lifetime of the object to a timer
+class ScopedTimer {
+ public:
+  explicit ScopedTimer(TaskTimer &timer) : timer_(timer), begin_(std::chrono::steady_clock::now()) {}
+  ScopedTimer(const ScopedTimer &) = delete;
+  ScopedTimer &operator=(const ScopedTimer &) = delete;
+  ScopedTimer(ScopedTimer &&) = delete;
+  ScopedTimer &operator=(ScopedTimer &&) = delete;
+  ~ScopedTimer();
+
+ private:
+  TaskTimer &timer_;
+  std::chrono::steady_clock::time_point begin_;
+};
+
 // Memory of inputs and outputs need to be initialized before create object of
 // Task class
 class Task {
@@ -27,6 +189,13 @@ class Task {
   // set input and output data
   void SetData(TaskDataPtr task_data);
 
+  // Replace input and output data with buffers of the same shape (count of buffers and their element
+  // counts) and start the pipeline over; the task keeps its internal buffers, so implementations that
+  // refill them (assign/resize) run without allocations. Throws std::invalid_argument on a shape change,
+  // use SetData in that case.
+  void Rebind(TaskDataPtr task_data);
+  [[nodiscard]] static bool SameShape(const TaskData &lhs, const TaskData &rhs);
+
   // validation of data and validation of task attributes before running
   virtual bool Validation();
 
@@ -39,15 +208,30 @@ class Task {
   // post-processing of output data
   virtual bool PostProcessing();
 
+  // Run the whole pipeline for every item of the batch and return the result of each; the task stays
+  // bound to the last item. Tasks that override RunBatchImpl share setup and communication across items.
+  std::vector<bool> RunBatch(const std::vector<TaskDataPtr> &batch);
+
   // get input and output data
   [[nodiscard]] TaskDataPtr GetData() const;
 
+  // get time spent in every phase and in marked regions since creation or the last ResetStats()
+  [[nodiscard]] const TaskStats &GetStats() const;
+  void ResetStats();
+
   virtual ~Task();
 
  protected:
   void InternalOrderTest(const std::string &str = __builtin_FUNCTION());
   TaskDataPtr task_data;
 
+  // mark a region of an implementation, e.g. `auto region = MeasureRegion("scatter");`
+  [[nodiscard]] ScopedTimer MeasureRegion(std::string_view name);
+
+  // pooled memory owned by the task for temporaries of hot loops, e.g. `std::pmr::vector<int> tmp(Memory());`;
+  // blocks are reused between iterations and runs, counts appear in GetStats().memory
+  [[nodiscard]] std::pmr::memory_resource *Memory();
+
   // implementation of "validation" function
   virtual bool ValidationImpl() = 0;
 
@@ -60,11 +244,24 @@ class Task {
   // implementation of "post_processing" function
   virtual bool PostProcessingImpl() = 0;
 
+  // implementation of "RunBatch" function, by default the pipeline is run item by item
+  virtual std::vector<bool> RunBatchImpl(const std::vector<TaskDataPtr> &batch);
+
  private:
-  std::vector<std::string> functions_order_;
+  // bind data keeping the state of testing and start the pipeline over
+  void Bind(TaskDataPtr task_data);
+
+  // count of pipeline functions called since SetData/Rebind and the last of them
+  std::size_t functions_called_ = 0;
+  std::string last_function_;
   std::vector<std::string> right_functions_order_ = {"Validation", "PreProcessing", "Run", "PostProcessing"};
-  const double max_test_time_ = 1.0;
-  std::chrono::high_resolution_clock::time_point tmp_time_point_;
+  // limit of one pipeline run in functional tests, func_max_time of the budget config (0 disables it)
+  double max_test_time_ = 1.0;
+  // time of PreProcessing and Run in stats_ when the pipeline started
+  double budget_start_sec_ = 0.0;
+  // memory counters are copied in on GetStats()
+  mutable TaskStats stats_;
+  std::unique_ptr<TaskMemory> memory_;
 };
 
 }  // namespace ppc::core
@@ -0,0 +1,122 @@
+#pragma once
+
+#include <condition_variable>
+#include <coroutine>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include "core/task/include/task.hpp"
+
+namespace ppc::core {
+
+namespace detail {
+
+struct TaskHandleState {
+  std::mutex mutex;
+  std::condition_variable done_cv;
+  bool done = false;
+  bool result = false;
+  std::exception_ptr error;
+  std::coroutine_handle<> continuation;
+
+  // returns the coroutine awaiting the task, if any, for the caller to resume
+  [[nodiscard]] std::coroutine_handle<> Complete(bool ok, std::exception_ptr exception = nullptr);
+};
+
+}  // namespace detail
+
+// Completion of one task submitted to a TaskStream. Can be waited on or awaited from a coroutine:
+// `bool ok = co_await handle;` resumes the coroutine on a separate thread of the stream once the task is counted
+// as finished, so the coroutine may wait for or destroy the stream and does not hold up the stages.
+class TaskHandle {
+ public:
+  explicit TaskHandle(std::shared_ptr<detail::TaskHandleState> state) : state_(std::move(state)) {}
+
+  [[nodiscard]] bool Ready() const;
+  void Wait() const;
+  // true if every phase succeeded; rethrows an exception thrown by a phase
+  [[nodiscard]] bool Get() const;
+
+  // NOLINTBEGIN(readability-identifier-naming)
+  [[nodiscard]] bool await_ready() const { return Ready(); }
+  bool await_suspend(std::coroutine_handle<> continuation) const;
+  bool await_resume() const { return Get(); }
+  // NOLINTEND(readability-identifier-naming)
+
+ private:
+  std::shared_ptr<detail::TaskHandleState> state_;
+};
+
+// Streams independent tasks through the pipeline with one thread per stage:
+// Validation + PreProcessing, Run, PostProcessing. While task N runs, task N+1 is pre-processed and
+// task N-1 post-processed. Every submitted task must be a separate instance bound to its own data;
+// tasks leave every stage in submission order. The phases of a task run on different threads, so MPI tasks
+// need MPI initialized with MPI_THREAD_MULTIPLE.
+class TaskStream {
+ public:
+  TaskStream();
+  TaskStream(const TaskStream &) = delete;
+  TaskStream &operator=(const TaskStream &) = delete;
+  TaskStream(TaskStream &&) = delete;
+  TaskStream &operator=(TaskStream &&) = delete;
+  // finishes all submitted tasks
+  ~TaskStream();
+
+  TaskHandle Submit(std::shared_ptr<Task> task);
+  // block until all submitted tasks are finished
+  void Wait();
+
+ private:
+  struct Item {
+    std::shared_ptr<Task> task;
+    std::shared_ptr<detail::TaskHandleState> state;
+    bool ok = true;
+  };
+
+  class Queue {
+   public:
+    void Push(Item item);
+    // false once the queue is closed and drained
+    bool Pop(Item &item);
+    void Close();
+
+   private:
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::deque<Item> items_;
+    bool closed_ = false;
+  };
+
+  void PrepareStage();
+  void RunStage();
+  void FinishStage();
+  void Finish(Item &item, std::exception_ptr exception = nullptr);
+
+  // continuations of coroutines awaiting a TaskHandle; shared with the resume thread, which is detached instead
+  // of joined when a continuation destroys the stream
+  struct ResumeQueue {
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::deque<std::coroutine_handle<>> handles;
+    bool closed = false;
+  };
+  static void ResumeStage(const std::shared_ptr<ResumeQueue> &queue);
+
+  Queue prepare_queue_;
+  Queue run_queue_;
+  Queue finish_queue_;
+  std::mutex pending_mutex_;
+  std::condition_variable pending_cv_;
+  std::size_t pending_ = 0;
+  std::shared_ptr<ResumeQueue> resume_queue_ = std::make_shared<ResumeQueue>();
+  std::thread prepare_thread_;
+  std::thread run_thread_;
+  std::thread finish_thread_;
+  std::thread resume_thread_;
+};
+
+}  // namespace ppc::core
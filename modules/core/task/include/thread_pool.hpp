@@ -0,0 +1,93 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace ppc::core {
+
+// Work-stealing pool whose threads live as long as the pool, so parallel regions do not pay for thread
+// creation. Every worker owns a deque: it takes its own jobs from the back and steals from the front of
+// the others. Idle workers spin for a while and then sleep until new jobs arrive. A thread waiting for a
+// group runs queued jobs itself, so the pool of size N has N - 1 workers plus the waiting thread.
+// Worker i is pinned with ppc::util::PinCurrentThread(i).
+class ThreadPool {
+ public:
+  // Jobs that are waited for together
+  class Group {
+   public:
+    Group() = default;
+    Group(const Group &) = delete;
+    Group &operator=(const Group &) = delete;
+    Group(Group &&) = delete;
+    Group &operator=(Group &&) = delete;
+    ~Group() = default;
+
+   private:
+    friend class ThreadPool;
+
+    std::atomic<std::size_t> unfinished_ = 0;
+    std::mutex mutex_;
+    std::condition_variable done_cv_;
+    std::exception_ptr error_;
+  };
+
+  // throws std::invalid_argument if threads < 1
+  explicit ThreadPool(int threads);
+  ThreadPool(const ThreadPool &) = delete;
+  ThreadPool &operator=(const ThreadPool &) = delete;
+  ThreadPool(ThreadPool &&) = delete;
+  ThreadPool &operator=(ThreadPool &&) = delete;
+  // runs the jobs that are still queued
+  ~ThreadPool();
+
+  // pool of the process sized by ppc::util::GetThreadConfig(), created on first use
+  static ThreadPool &Shared();
+
+  [[nodiscard]] int Size() const { return static_cast<int>(workers_.size()) + 1; }
+
+  // queue a job; may be called from inside jobs
+  void Submit(Group &group, std::function<void()> job);
+  // run queued jobs until every job of the group is finished; rethrows the first exception of the group
+  void Wait(Group &group);
+  // call fn(chunk_begin, chunk_end) for chunks of [begin, end) with at most `grain` elements
+  // (0 picks a few chunks per thread) and wait for them
+  void ParallelFor(std::size_t begin, std::size_t end, const std::function<void(std::size_t, std::size_t)> &fn,
+                   std::size_t grain = 0);
+
+ private:
+  struct Job {
+    std::function<void()> fn;
+    Group *group = nullptr;
+  };
+  struct Queue {
+    std::mutex mutex;
+    std::deque<Job> jobs;
+  };
+
+  // queue of the calling thread: its own for a worker, the shared queue 0 for other threads
+  [[nodiscard]] std::size_t CurrentQueue() const;
+  bool RunOne(std::size_t queue);
+  void Execute(Job &job);
+  void Worker(std::size_t queue);
+
+  // queues_[i] belongs to worker i and queues_[0] to threads outside the pool; jobs submitted from outside
+  // are spread over all queues
+  std::vector<std::unique_ptr<Queue>> queues_;
+  std::vector<std::thread> workers_;
+  std::atomic<std::size_t> queued_ = 0;
+  std::atomic<std::size_t> next_queue_ = 0;
+  std::atomic<int> sleeping_ = 0;
+  std::atomic<bool> stop_ = false;
+  std::mutex park_mutex_;
+  std::condition_variable park_cv_;
+};
+
+}  // namespace ppc::core
@@ -0,0 +1,180 @@
+#include "core/task/include/dataset.hpp"
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "core/util/include/mapped_file.hpp"
+
+namespace {
+
+constexpr std::array<char, 8> kMagic = {'P', 'P', 'C', 'D', 'S', 'E', 'T', '\0'};
+constexpr std::size_t kHeaderSize = 128;
+
+struct Header {
+  std::array<char, 8> magic{};
+  uint32_t version = 0;
+  uint8_t dtype = 0;
+  uint8_t layout = 0;
+  uint16_t rank = 0;
+  std::array<uint64_t, ppc::core::Dataset::kMaxRank> shape{};
+  uint64_t payload_offset = 0;
+  uint64_t payload_bytes = 0;
+  std::array<uint8_t, 32> reserved{};
+};
+static_assert(sizeof(Header) == kHeaderSize, "the header layout is part of the file format");
+static_assert(kHeaderSize % ppc::core::Dataset::kAlignment == 0);
+
+void CheckLittleEndian() {
+  if constexpr (std::endian::native != std::endian::little) {
+    throw std::runtime_error("Dataset: only little-endian hosts are supported");
+  }
+}
+
+// a * b or nullopt if the product does not fit
+std::optional<uint64_t> CheckedMul(std::optional<uint64_t> a, uint64_t b) {
+  if (!a || (b != 0 && *a > std::numeric_limits<uint64_t>::max() / b)) {
+    return std::nullopt;
+  }
+  return *a * b;
+}
+
+}  // namespace
+
+std::size_t ppc::core::DTypeSize(DType dtype) {
+  switch (dtype) {
+    case DType::kUInt8:
+    case DType::kInt8:
+      return 1;
+    case DType::kUInt16:
+    case DType::kInt16:
+      return 2;
+    case DType::kUInt32:
+    case DType::kInt32:
+    case DType::kFloat32:
+      return 4;
+    case DType::kUInt64:
+    case DType::kInt64:
+    case DType::kFloat64:
+      return 8;
+  }
+  throw std::invalid_argument("Dataset: unknown dtype " + std::to_string(static_cast<int>(dtype)));
+}
+
+std::string ppc::core::DTypeName(DType dtype) {
+  switch (dtype) {
+    case DType::kUInt8:
+      return "uint8";
+    case DType::kInt8:
+      return "int8";
+    case DType::kUInt16:
+      return "uint16";
+    case DType::kInt16:
+      return "int16";
+    case DType::kUInt32:
+      return "uint32";
+    case DType::kInt32:
+      return "int32";
+    case DType::kUInt64:
+      return "uint64";
+    case DType::kInt64:
+      return "int64";
+    case DType::kFloat32:
+      return "float32";
+    case DType::kFloat64:
+      return "float64";
+  }
+  return "dtype " + std::to_string(static_cast<int>(dtype));
+}
+
+std::shared_ptr<ppc::core::Dataset> ppc::core::Dataset::Open(const std::string &path) {
+  CheckLittleEndian();
+  std::shared_ptr<Dataset> dataset(new Dataset());
+  dataset->file_ = ppc::util::MappedFile(path);
+  const auto &file = dataset->file_;
+
+  Header header;
+  if (file.Size() < kHeaderSize) {
+    throw std::runtime_error("Dataset: " + path + " is too short for a dataset header");
+  }
+  std::memcpy(&header, file.Data(), sizeof(header));
+  if (header.magic != kMagic) {
+    throw std::runtime_error("Dataset: " + path + " is not a dataset");
+  }
+  if (header.version == 0 || header.version > kVersion) {
+    throw std::runtime_error("Dataset: " + path + " has format version " + std::to_string(header.version) +
+                             ", this build reads versions up to " + std::to_string(kVersion));
+  }
+  if (header.rank == 0 || header.rank > kMaxRank) {
+    throw std::runtime_error("Dataset: " + path + " has " + std::to_string(header.rank) + " dimensions");
+  }
+  const auto layout = static_cast<Layout>(header.layout);
+  if (layout != Layout::kRowMajor && layout != Layout::kColMajor) {
+    throw std::runtime_error("Dataset: " + path + " has an unknown layout");
+  }
+  if (header.dtype < static_cast<uint8_t>(DType::kUInt8) || header.dtype > static_cast<uint8_t>(DType::kFloat64)) {
+    throw std::runtime_error("Dataset: " + path + " has an unknown dtype " + std::to_string(header.dtype));
+  }
+  const auto dtype = static_cast<DType>(header.dtype);
+  const auto element_size = DTypeSize(dtype);
+  std::optional<uint64_t> count = 1;
+  for (uint16_t i = 0; i < header.rank; i++) {
+    count = CheckedMul(count, header.shape[i]);
+  }
+  // a corrupt shape must not wrap around to the size of the payload
+  const auto payload_bytes = CheckedMul(count, element_size);
+  if (!payload_bytes || header.payload_offset % kAlignment != 0 || header.payload_offset < kHeaderSize ||
+      header.payload_bytes != *payload_bytes || header.payload_offset > file.Size() ||
+      header.payload_bytes > file.Size() - header.payload_offset) {
+    throw std::runtime_error("Dataset: " + path + " is truncated or its header is corrupt");
+  }
+
+  dataset->payload_ = file.Data() + header.payload_offset;
+  dataset->dtype_ = dtype;
+  dataset->layout_ = layout;
+  dataset->shape_.assign(header.shape.begin(), header.shape.begin() + header.rank);
+  dataset->count_ = *count;
+  return dataset;
+}
+
+void ppc::core::Dataset::Write(const std::string &path, DType dtype, const std::vector<uint64_t> &shape,
+                               const void *data, Layout layout) {
+  CheckLittleEndian();
+  if (shape.empty() || shape.size() > kMaxRank) {
+    throw std::invalid_argument("Dataset: a dataset has 1 to " + std::to_string(kMaxRank) + " dimensions");
+  }
+  Header header;
+  header.magic = kMagic;
+  header.version = kVersion;
+  header.dtype = static_cast<uint8_t>(dtype);
+  header.layout = static_cast<uint8_t>(layout);
+  header.rank = static_cast<uint16_t>(shape.size());
+  std::optional<uint64_t> count = 1;
+  for (std::size_t i = 0; i < shape.size(); i++) {
+    header.shape[i] = shape[i];
+    count = CheckedMul(count, shape[i]);
+  }
+  const auto payload_bytes = CheckedMul(count, DTypeSize(dtype));
+  if (!payload_bytes || *payload_bytes > static_cast<uint64_t>(std::numeric_limits<std::streamsize>::max())) {
+    throw std::invalid_argument("Dataset: the shape is too large");
+  }
+  header.payload_offset = kHeaderSize;
+  header.payload_bytes = *payload_bytes;
+
+  std::ofstream file(path, std::ios::binary | std::ios::trunc);
+  file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+  file.write(static_cast<const char *>(data), static_cast<std::streamsize>(header.payload_bytes));
+  file.close();
+  if (!file) {
+    throw std::runtime_error("Dataset: cannot write " + path);
+  }
+}
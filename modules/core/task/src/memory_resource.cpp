@@ -0,0 +1,45 @@
+#include "core/task/include/memory_resource.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <memory_resource>
+
+void ppc::core::CountingResource::ResetCounters() {
+  allocations_ = 0;
+  deallocations_ = 0;
+  bytes_ = 0;
+  peak_bytes_ = live_bytes_;
+}
+
+void *ppc::core::CountingResource::do_allocate(std::size_t bytes, std::size_t alignment) {
+  void *p = upstream_->allocate(bytes, alignment);
+  allocations_++;
+  bytes_ += bytes;
+  live_bytes_ += bytes;
+  peak_bytes_ = std::max(peak_bytes_, live_bytes_);
+  return p;
+}
+
+void ppc::core::CountingResource::do_deallocate(void *p, std::size_t bytes, std::size_t alignment) {
+  upstream_->deallocate(p, bytes, alignment);
+  deallocations_++;
+  live_bytes_ -= bytes;
+}
+
+bool ppc::core::CountingResource::do_is_equal(const std::pmr::memory_resource &other) const noexcept {
+  return this == &other;
+}
+
+ppc::core::TaskMemoryStats ppc::core::TaskMemory::Stats() const {
+  return {.allocations = requests_.Allocations(),
+          .deallocations = requests_.Deallocations(),
+          .bytes = requests_.Bytes(),
+          .peak_bytes = requests_.PeakBytes(),
+          .upstream_allocations = upstream_.Allocations(),
+          .upstream_bytes = upstream_.Bytes()};
+}
+
+void ppc::core::TaskMemory::ResetStats() {
+  requests_.ResetCounters();
+  upstream_.ResetCounters();
+}
@@ -0,0 +1,53 @@
+#include "core/task/include/partition.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+ppc::core::Partition::Partition(std::vector<uint64_t> counts, uint64_t row_size)
+    : counts_(std::move(counts)), offsets_(counts_.size() + 1, 0), row_size_(row_size) {
+  if (counts_.empty()) {
+    throw std::invalid_argument("Partition: at least one part is required");
+  }
+  if (row_size_ == 0) {
+    throw std::invalid_argument("Partition: row size must be positive");
+  }
+  for (std::size_t i = 0; i < counts_.size(); i++) {
+    if (counts_[i] % row_size_ != 0) {
+      throw std::invalid_argument("Partition: count " + std::to_string(counts_[i]) + " of part " + std::to_string(i) +
+                                  " is not a multiple of the row size " + std::to_string(row_size_));
+    }
+    offsets_[i + 1] = offsets_[i] + counts_[i];
+  }
+}
+
+ppc::core::Partition ppc::core::Partition::Block(uint64_t count, int parts) { return Rows(count, 1, parts); }
+
+ppc::core::Partition ppc::core::Partition::Rows(uint64_t rows, uint64_t row_size, int parts) {
+  if (parts <= 0) {
+    throw std::invalid_argument("Partition: count of parts must be positive");
+  }
+  const auto n = static_cast<uint64_t>(parts);
+  std::vector<uint64_t> counts(n);
+  for (uint64_t i = 0; i < n; i++) {
+    counts[i] = ((rows / n) + (i < rows % n ? 1 : 0)) * row_size;
+  }
+  return {std::move(counts), row_size};
+}
+
+ppc::core::Partition ppc::core::Partition::FromCounts(const std::vector<uint64_t> &counts, uint64_t row_size) {
+  return {counts, row_size};
+}
+
+int ppc::core::Partition::RowOwner(uint64_t row) const {
+  if (row >= Rows()) {
+    throw std::out_of_range("Partition: row " + std::to_string(row) + " is out of range");
+  }
+  // the last part starting at or before the row; empty parts share the offset of the next one
+  auto it = std::upper_bound(offsets_.begin(), offsets_.end(), row * row_size_);
+  return static_cast<int>(it - offsets_.begin()) - 1;
+}
@@ -1,66 +1,170 @@
 #include "core/task/include/task.hpp"
 
+#include <algorithm>
+#include <chrono>
 #include <cstddef>
 #include <iomanip>
 #include <iostream>
+#include <memory>
+#include <memory_resource>
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <string_view>
+#include <vector>
+
+#include "core/util/include/budget.hpp"
 
 void ppc::core::Task::SetData(TaskDataPtr task_data_ptr) {
   task_data_ptr->state_of_testing = TaskData::StateOfTesting::kFunc;
-  functions_order_.clear();
+  functions_called_ = 0;
+  last_function_.clear();
+  this->task_data = std::move(task_data_ptr);
+}
+
+bool ppc::core::Task::SameShape(const TaskData& lhs, const TaskData& rhs) {
+  return lhs.inputs.size() == rhs.inputs.size() && lhs.outputs.size() == rhs.outputs.size() &&
+         lhs.inputs_count == rhs.inputs_count && lhs.outputs_count == rhs.outputs_count;
+}
+
+void ppc::core::Task::Rebind(TaskDataPtr task_data_ptr) {
+  if (!SameShape(*task_data, *task_data_ptr)) {
+    throw std::invalid_argument("Rebind: inputs/outputs differ in shape from the bound ones, use SetData");
+  }
+  Bind(std::move(task_data_ptr));
+}
+
+void ppc::core::Task::Bind(TaskDataPtr task_data_ptr) {
+  task_data_ptr->state_of_testing = task_data->state_of_testing;
+  functions_called_ = 0;
+  last_function_.clear();
   this->task_data = std::move(task_data_ptr);
 }
 
 ppc::core::TaskDataPtr ppc::core::Task::GetData() const { return task_data; }
 
-ppc::core::Task::Task(TaskDataPtr task_data) { SetData(std::move(task_data)); }
+ppc::core::Task::Task(TaskDataPtr task_data) {
+  SetData(std::move(task_data));
+  max_test_time_ = ppc::util::CurrentTaskBudget().func_max_time.value_or(max_test_time_);
+}
 
 bool ppc::core::Task::Validation() {
   InternalOrderTest();
+  ScopedTimer timer(stats_.validation);
   return ValidationImpl();
 }
 
 bool ppc::core::Task::PreProcessing() {
   InternalOrderTest();
+  ScopedTimer timer(stats_.pre_processing);
   return PreProcessingImpl();
 }
 
 bool ppc::core::Task::Run() {
   InternalOrderTest();
+  ScopedTimer timer(stats_.run);
   return RunImpl();
 }
 
 bool ppc::core::Task::PostProcessing() {
   InternalOrderTest();
+  ScopedTimer timer(stats_.post_processing);
   return PostProcessingImpl();
 }
 
+std::vector<bool> ppc::core::Task::RunBatch(const std::vector<TaskDataPtr>& batch) {
+  if (std::ranges::any_of(batch, [](const auto& item) { return item == nullptr; })) {
+    throw std::invalid_argument("RunBatch: batch contains an empty TaskDataPtr");
+  }
+  if (batch.empty()) {
+    return {};
+  }
+  std::vector<bool> results;
+  {
+    auto region = MeasureRegion("batch");
+    results = RunBatchImpl(batch);
+  }
+  if (results.size() != batch.size()) {
+    throw std::runtime_error("RunBatch: expected " + std::to_string(batch.size()) + " results, got " +
+                             std::to_string(results.size()));
+  }
+  if (task_data != batch.back()) {
+    Bind(batch.back());
+  }
+  return results;
+}
+
+std::vector<bool> ppc::core::Task::RunBatchImpl(const std::vector<TaskDataPtr>& batch) {
+  std::vector<bool> results;
+  results.reserve(batch.size());
+  for (const auto& item : batch) {
+    Bind(item);
+    results.push_back(Validation() && PreProcessing() && Run() && PostProcessing());
+  }
+  return results;
+}
+
+const ppc::core::TaskStats& ppc::core::Task::GetStats() const {
+  if (memory_) {
+    stats_.memory = memory_->Stats();
+  }
+  return stats_;
+}
+
+void ppc::core::Task::ResetStats() {
+  stats_ = TaskStats();
+  if (memory_) {
+    memory_->ResetStats();
+  }
+}
+
+std::pmr::memory_resource* ppc::core::Task::Memory() {
+  if (!memory_) {
+    memory_ = std::make_unique<TaskMemory>();
+  }
+  return memory_->Resource();
+}
+
+ppc::core::ScopedTimer ppc::core::Task::MeasureRegion(std::string_view name) {
+  auto it = stats_.regions.find(name);
+  if (it == stats_.regions.end()) {
+    it = stats_.regions.emplace(std::string(name), TaskTimer()).first;
+  }
+  return ScopedTimer(it->second);
+}
+
+ppc::core::ScopedTimer::~ScopedTimer() {
+  auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - begin_);
+  auto seconds = static_cast<double>(duration.count()) * 1e-9;
+  timer_.calls++;
+  timer_.total_sec += seconds;
+  timer_.last_sec = seconds;
+  timer_.max_sec = std::max(timer_.max_sec, seconds);
+}
+
 void ppc::core::Task::InternalOrderTest(const std::string& str) {
-  if (!functions_order_.empty() && str == functions_order_.back() && str == "Run") {
+  if (str == last_function_ && str == "Run") {
     return;
   }
 
-  functions_order_.push_back(str);
-
-  for (size_t i = 0; i < functions_order_.size(); i++) {
-    if (functions_order_[i] != right_functions_order_[i % right_functions_order_.size()]) {
-      throw std::invalid_argument("ORDER OF FUCTIONS IS NOT RIGHT: \n" + std::string("Serial number: ") +
-                                  std::to_string(i + 1) + "\n" + std::string("Yours function: ") + functions_order_[i] +
-                                  "\n" + std::string("Expected function: ") + right_functions_order_[i]);
-    }
+  // earlier calls are already checked, so only the position of the new one matters
+  const auto& expected = right_functions_order_[functions_called_ % right_functions_order_.size()];
+  functions_called_++;
+  if (str != expected) {
+    throw std::invalid_argument("ORDER OF FUCTIONS IS NOT RIGHT: \n" + std::string("Serial number: ") +
+                                std::to_string(functions_called_) + "\n" + std::string("Yours function: ") + str +
+                                "\n" + std::string("Expected function: ") + expected);
   }
+  last_function_ = str;
 
+  // only the phases are timed, not the waits between them (e.g. in the stage queues of a TaskStream)
   if (str == "PreProcessing" && task_data->state_of_testing == TaskData::StateOfTesting::kFunc) {
-    tmp_time_point_ = std::chrono::high_resolution_clock::now();
+    budget_start_sec_ = stats_.pre_processing.total_sec + stats_.run.total_sec;
   }
 
   if (str == "PostProcessing" && task_data->state_of_testing == TaskData::StateOfTesting::kFunc) {
-    auto end = std::chrono::high_resolution_clock::now();
-    auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(end - tmp_time_point_).count();
-    auto current_time = static_cast<double>(duration) * 1e-9;
-    if (current_time < max_test_time_) {
+    auto current_time = std::max(stats_.pre_processing.total_sec + stats_.run.total_sec - budget_start_sec_, 0.0);
+    if (max_test_time_ <= 0.0 || current_time < max_test_time_) {
       std::cout << "Test time:" << std::fixed << std::setprecision(10) << current_time;
     } else {
       std::stringstream err_msg;
@@ -72,4 +176,4 @@ void ppc::core::Task::InternalOrderTest(const std::string& str) {
   }
 }
 
-ppc::core::Task::~Task() { functions_order_.clear(); }
+ppc::core::Task::~Task() = default;
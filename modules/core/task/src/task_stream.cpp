@@ -0,0 +1,194 @@
+#include "core/task/include/task_stream.hpp"
+
+#include <coroutine>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+std::coroutine_handle<> ppc::core::detail::TaskHandleState::Complete(bool ok, std::exception_ptr exception) {
+  std::coroutine_handle<> waiter;
+  {
+    const std::lock_guard lock(mutex);
+    done = true;
+    result = ok;
+    error = std::move(exception);
+    waiter = std::exchange(continuation, nullptr);
+  }
+  done_cv.notify_all();
+  return waiter;
+}
+
+bool ppc::core::TaskHandle::Ready() const {
+  const std::lock_guard lock(state_->mutex);
+  return state_->done;
+}
+
+void ppc::core::TaskHandle::Wait() const {
+  std::unique_lock lock(state_->mutex);
+  state_->done_cv.wait(lock, [this] { return state_->done; });
+}
+
+bool ppc::core::TaskHandle::Get() const {
+  Wait();
+  if (state_->error) {
+    std::rethrow_exception(state_->error);
+  }
+  return state_->result;
+}
+
+bool ppc::core::TaskHandle::await_suspend(std::coroutine_handle<> continuation) const {
+  const std::lock_guard lock(state_->mutex);
+  if (state_->done) {
+    return false;
+  }
+  state_->continuation = continuation;
+  return true;
+}
+
+ppc::core::TaskStream::TaskStream()
+    : prepare_thread_([this] { PrepareStage(); }),
+      run_thread_([this] { RunStage(); }),
+      finish_thread_([this] { FinishStage(); }),
+      resume_thread_([queue = resume_queue_] { ResumeStage(queue); }) {}
+
+ppc::core::TaskStream::~TaskStream() {
+  prepare_queue_.Close();
+  prepare_thread_.join();
+  run_queue_.Close();
+  run_thread_.join();
+  finish_queue_.Close();
+  finish_thread_.join();
+  {
+    const std::lock_guard lock(resume_queue_->mutex);
+    resume_queue_->closed = true;
+  }
+  resume_queue_->cv.notify_all();
+  if (resume_thread_.get_id() == std::this_thread::get_id()) {
+    // destroyed by an awaiting coroutine: the thread resumes the rest of the queue on its own
+    resume_thread_.detach();
+  } else {
+    resume_thread_.join();
+  }
+}
+
+ppc::core::TaskHandle ppc::core::TaskStream::Submit(std::shared_ptr<Task> task) {
+  if (!task) {
+    throw std::invalid_argument("TaskStream: task is null");
+  }
+  auto state = std::make_shared<detail::TaskHandleState>();
+  {
+    const std::lock_guard lock(pending_mutex_);
+    pending_++;
+  }
+  prepare_queue_.Push({.task = std::move(task), .state = state});
+  return TaskHandle(state);
+}
+
+void ppc::core::TaskStream::Wait() {
+  std::unique_lock lock(pending_mutex_);
+  pending_cv_.wait(lock, [this] { return pending_ == 0; });
+}
+
+void ppc::core::TaskStream::PrepareStage() {
+  Item item;
+  while (prepare_queue_.Pop(item)) {
+    try {
+      if (item.task->Validation() && item.task->PreProcessing()) {
+        run_queue_.Push(std::move(item));
+      } else {
+        // a task that failed validation is not run
+        item.ok = false;
+        Finish(item);
+      }
+    } catch (...) {
+      Finish(item, std::current_exception());
+    }
+  }
+}
+
+void ppc::core::TaskStream::RunStage() {
+  Item item;
+  while (run_queue_.Pop(item)) {
+    try {
+      item.ok = item.task->Run();
+      finish_queue_.Push(std::move(item));
+    } catch (...) {
+      Finish(item, std::current_exception());
+    }
+  }
+}
+
+void ppc::core::TaskStream::FinishStage() {
+  Item item;
+  while (finish_queue_.Pop(item)) {
+    try {
+      item.ok = item.task->PostProcessing() && item.ok;
+      Finish(item);
+    } catch (...) {
+      Finish(item, std::current_exception());
+    }
+  }
+}
+
+void ppc::core::TaskStream::Finish(Item &item, std::exception_ptr exception) {
+  auto state = std::move(item.state);
+  item.task.reset();
+  auto waiter = state->Complete(item.ok, std::move(exception));
+  {
+    const std::lock_guard lock(pending_mutex_);
+    pending_--;
+  }
+  pending_cv_.notify_all();
+  if (waiter) {
+    {
+      const std::lock_guard lock(resume_queue_->mutex);
+      resume_queue_->handles.push_back(waiter);
+    }
+    resume_queue_->cv.notify_one();
+  }
+}
+
+void ppc::core::TaskStream::ResumeStage(const std::shared_ptr<ResumeQueue> &queue) {
+  std::unique_lock lock(queue->mutex);
+  while (true) {
+    queue->cv.wait(lock, [&] { return queue->closed || !queue->handles.empty(); });
+    if (queue->handles.empty()) {
+      return;
+    }
+    auto handle = queue->handles.front();
+    queue->handles.pop_front();
+    lock.unlock();
+    handle.resume();
+    lock.lock();
+  }
+}
+
+void ppc::core::TaskStream::Queue::Push(Item item) {
+  {
+    const std::lock_guard lock(mutex_);
+    items_.push_back(std::move(item));
+  }
+  cv_.notify_one();
+}
+
+bool ppc::core::TaskStream::Queue::Pop(Item &item) {
+  std::unique_lock lock(mutex_);
+  cv_.wait(lock, [this] { return closed_ || !items_.empty(); });
+  if (items_.empty()) {
+    return false;
+  }
+  item = std::move(items_.front());
+  items_.pop_front();
+  return true;
+}
+
+void ppc::core::TaskStream::Queue::Close() {
+  {
+    const std::lock_guard lock(mutex_);
+    closed_ = true;
+  }
+  cv_.notify_all();
+}
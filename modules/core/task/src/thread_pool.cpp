@@ -0,0 +1,197 @@
+#include "core/task/include/thread_pool.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+#include "core/util/include/thread_config.hpp"
+
+namespace {
+
+// failed attempts to find a job before an idle thread sleeps
+constexpr int kSpins = 64;
+// a waiting thread wakes up this often to help with jobs submitted meanwhile
+constexpr auto kWaitSlice = std::chrono::microseconds(200);
+// chunks per thread of ParallelFor without a grain
+constexpr std::size_t kChunksPerThread = 4;
+
+// pool and queue of the current thread if it is a worker
+thread_local const ppc::core::ThreadPool *current_pool = nullptr;
+thread_local std::size_t current_queue = 0;
+
+}  // namespace
+
+ppc::core::ThreadPool::ThreadPool(int threads) {
+  if (threads < 1) {
+    throw std::invalid_argument("ThreadPool: at least one thread is required");
+  }
+  for (int i = 0; i < threads; i++) {
+    queues_.push_back(std::make_unique<Queue>());
+  }
+  workers_.reserve(threads - 1);
+  for (std::size_t queue = 1; queue < queues_.size(); queue++) {
+    workers_.emplace_back([this, queue] { Worker(queue); });
+  }
+}
+
+ppc::core::ThreadPool::~ThreadPool() {
+  {
+    const std::lock_guard lock(park_mutex_);
+    stop_ = true;
+  }
+  park_cv_.notify_all();
+  for (auto &worker : workers_) {
+    worker.join();
+  }
+  while (RunOne(0)) {
+  }
+}
+
+ppc::core::ThreadPool &ppc::core::ThreadPool::Shared() {
+  static ThreadPool pool(std::max(ppc::util::GetThreadConfig().num_threads, 1));
+  return pool;
+}
+
+void ppc::core::ThreadPool::Submit(Group &group, std::function<void()> job) {
+  auto queue = CurrentQueue();
+  if (queue == 0) {
+    queue = next_queue_++ % queues_.size();
+  }
+  group.unfinished_++;
+  {
+    const std::lock_guard lock(queues_[queue]->mutex);
+    queues_[queue]->jobs.push_back({.fn = std::move(job), .group = &group});
+  }
+  queued_++;
+  if (sleeping_ > 0) {
+    // taking the mutex orders the wake-up after a worker that checked queued_ has started waiting
+    { const std::lock_guard lock(park_mutex_); }
+    park_cv_.notify_one();
+  }
+}
+
+void ppc::core::ThreadPool::Wait(Group &group) {
+  const auto queue = CurrentQueue();
+  int spins = 0;
+  while (group.unfinished_ > 0) {
+    if (RunOne(queue)) {
+      spins = 0;
+    } else if (++spins < kSpins) {
+      std::this_thread::yield();
+    } else {
+      std::unique_lock lock(group.mutex_);
+      group.done_cv_.wait_for(lock, kWaitSlice, [&] { return group.unfinished_ == 0; });
+      spins = 0;
+    }
+  }
+  const std::lock_guard lock(group.mutex_);
+  if (group.error_) {
+    std::rethrow_exception(std::exchange(group.error_, nullptr));
+  }
+}
+
+void ppc::core::ThreadPool::ParallelFor(std::size_t begin, std::size_t end,
+                                        const std::function<void(std::size_t, std::size_t)> &fn, std::size_t grain) {
+  if (begin >= end) {
+    return;
+  }
+  const auto count = end - begin;
+  if (grain == 0) {
+    grain = std::max<std::size_t>(count / (static_cast<std::size_t>(Size()) * kChunksPerThread), 1);
+  }
+  if (Size() == 1 || count <= grain) {
+    fn(begin, end);
+    return;
+  }
+  Group group;
+  for (auto chunk_begin = begin; chunk_begin < end; chunk_begin += std::min(grain, end - chunk_begin)) {
+    const auto chunk_end = chunk_begin + std::min(grain, end - chunk_begin);
+    Submit(group, [&fn, chunk_begin, chunk_end] { fn(chunk_begin, chunk_end); });
+  }
+  Wait(group);
+}
+
+std::size_t ppc::core::ThreadPool::CurrentQueue() const { return current_pool == this ? current_queue : 0; }
+
+bool ppc::core::ThreadPool::RunOne(std::size_t queue) {
+  Job job;
+  bool found = false;
+  {
+    // own jobs newest first, they are the most likely to be in cache
+    auto &own = *queues_[queue];
+    const std::lock_guard lock(own.mutex);
+    if (!own.jobs.empty()) {
+      job = std::move(own.jobs.back());
+      own.jobs.pop_back();
+      found = true;
+    }
+  }
+  for (std::size_t i = 1; !found && i < queues_.size(); i++) {
+    // steal the oldest job, usually the largest piece of the victim's work
+    auto &victim = *queues_[(queue + i) % queues_.size()];
+    const std::lock_guard lock(victim.mutex);
+    if (!victim.jobs.empty()) {
+      job = std::move(victim.jobs.front());
+      victim.jobs.pop_front();
+      found = true;
+    }
+  }
+  if (!found) {
+    return false;
+  }
+  queued_--;
+  Execute(job);
+  return true;
+}
+
+void ppc::core::ThreadPool::Execute(Job &job) {
+  auto &group = *job.group;
+  try {
+    job.fn();
+  } catch (...) {
+    const std::lock_guard lock(group.mutex_);
+    if (!group.error_) {
+      group.error_ = std::current_exception();
+    }
+  }
+  // release the captures before the waiter may return
+  job.fn = nullptr;
+  const std::lock_guard lock(group.mutex_);
+  if (--group.unfinished_ == 0) {
+    group.done_cv_.notify_all();
+  }
+}
+
+void ppc::core::ThreadPool::Worker(std::size_t queue) {
+  current_pool = this;
+  current_queue = queue;
+  ppc::util::PinCurrentThread(static_cast<int>(queue));
+  int spins = 0;
+  while (true) {
+    if (RunOne(queue)) {
+      spins = 0;
+      continue;
+    }
+    if (stop_) {
+      return;
+    }
+    if (++spins < kSpins) {
+      std::this_thread::yield();
+      continue;
+    }
+    sleeping_++;
+    {
+      std::unique_lock lock(park_mutex_);
+      park_cv_.wait(lock, [this] { return stop_ || queued_ > 0; });
+    }
+    sleeping_--;
+    spins = 0;
+  }
+}
@@ -1,9 +1,20 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <cstdint>
 #include <cstdlib>
+#include <filesystem>
+#include <random>
+#include <sstream>
+#include <stdexcept>
 #include <string>
 #include <thread>
+#include <vector>
 
+#include "core/util/include/budget.hpp"
+#include "core/util/include/data_cache.hpp"
+#include "core/util/include/random.hpp"
+#include "core/util/include/thread_config.hpp"
 #include "core/util/include/util.hpp"
 
 TEST(util_tests, check_unset_env) {
@@ -34,3 +45,138 @@ TEST(util_tests, check_set_env) {
   GTEST_SKIP();
 #endif
 }
+
+TEST(util_tests, check_budget_config) {
+  std::istringstream in(
+      "# defaults\n"
+      "default func_max_time=2 perf_max_time=10\n"
+      "mpi/sobel perf_max_time=120  # big images\n"
+      "mpi/sobel:task_run baseline_median=0.5 max_regression=0.1\n");
+  auto config = ppc::util::BudgetConfig::Parse(in);
+
+  auto budget = config.Lookup("mpi", "sobel", "task_run");
+  EXPECT_EQ(budget.func_max_time, 2.0);
+  EXPECT_EQ(budget.perf_max_time, 120.0);
+  EXPECT_EQ(budget.baseline_median, 0.5);
+  EXPECT_EQ(budget.max_regression, 0.1);
+
+  budget = config.Lookup("mpi", "sobel", "pipeline");
+  EXPECT_EQ(budget.perf_max_time, 120.0);
+  EXPECT_FALSE(budget.baseline_median.has_value());
+  EXPECT_EQ(config.Lookup("seq", "other").perf_max_time, 10.0);
+
+  for (const auto *line : {"default func_max_time", "default func_max_time=fast", "default speed=1",
+                           "default perf_max_time=-1"}) {
+    std::istringstream bad(line);
+    EXPECT_THROW(ppc::util::BudgetConfig::Parse(bad), std::invalid_argument) << line;
+  }
+}
+
+TEST(util_tests, check_cpu_list) {
+  EXPECT_EQ(ppc::util::ParseCpuList("0,2,8-11"), (std::vector<int>{0, 2, 8, 9, 10, 11}));
+  EXPECT_EQ(ppc::util::ParseCpuList("5"), std::vector<int>{5});
+  for (const auto *list : {"", "1-", "a", "3-1", "1,,2", "-1"}) {
+    EXPECT_THROW(ppc::util::ParseCpuList(list), std::invalid_argument) << list;
+  }
+}
+
+TEST(util_tests, check_select_cpus) {
+  // 2 packages (one NUMA node each) x 2 cores x 2 hardware threads
+  std::vector<ppc::util::CpuInfo> topology;
+  for (int cpu = 0; cpu < 8; cpu++) {
+    topology.push_back({.cpu = cpu, .package = (cpu / 2) % 2, .core = cpu % 2, .node = (cpu / 2) % 2});
+  }
+  ppc::util::ThreadConfig config;
+  EXPECT_TRUE(ppc::util::SelectCpus(config, topology).empty());
+
+  config.pin = ppc::util::PinPolicy::kCompact;
+  EXPECT_EQ(ppc::util::SelectCpus(config, topology), (std::vector<int>{0, 1, 4, 5, 2, 3, 6, 7}));
+  config.pin = ppc::util::PinPolicy::kScatter;
+  EXPECT_EQ(ppc::util::SelectCpus(config, topology), (std::vector<int>{0, 2, 1, 3, 4, 6, 5, 7}));
+
+  // two processes on the node get disjoint halves
+  config.pin = ppc::util::PinPolicy::kCompact;
+  config.local_ranks = 2;
+  config.local_rank = 1;
+  EXPECT_EQ(ppc::util::SelectCpus(config, topology), (std::vector<int>{2, 3, 6, 7}));
+  config.local_ranks = 1;
+  config.local_rank = 0;
+  config.numa_node = 1;
+  EXPECT_EQ(ppc::util::SelectCpus(config, topology), (std::vector<int>{2, 3, 6, 7}));
+
+  config.numa_node = -1;
+  config.pin = ppc::util::PinPolicy::kExplicit;
+  config.cpu_list = {7, 0, 1};
+  config.local_ranks = 2;
+  EXPECT_EQ(ppc::util::SelectCpus(config, topology), std::vector<int>{7});
+  config.local_rank = 1;
+  EXPECT_EQ(ppc::util::SelectCpus(config, topology), (std::vector<int>{0, 1}));
+
+  config.cpus = {4, 5};
+  EXPECT_EQ(config.CpuFor(3), 5);
+  config.cpus.clear();
+  EXPECT_EQ(config.CpuFor(0), -1);
+}
+
+TEST(util_tests, check_random_is_reproducible) {
+  ppc::util::Random a(42);
+  ppc::util::Random b(42);
+  EXPECT_EQ(a.Vector<int>(100, -5, 5), b.Vector<int>(100, -5, 5));
+  EXPECT_NE(ppc::util::Random(42, "matrix").Next(), ppc::util::Random(42, "vector").Next());
+  // the sequence is part of the contract: cached datasets and baselines depend on it
+  EXPECT_EQ(ppc::util::Random(0).Next(), 0x99EC5F36CB75F2B4ULL);
+
+  auto values = a.Vector<double>(1000, -1.0, 1.0);
+  EXPECT_TRUE(std::ranges::all_of(values, [](double v) { return v >= -1.0 && v < 1.0; }));
+  auto ints = a.Vector<int64_t>(1000, 3, 4);
+  EXPECT_EQ(std::ranges::count(ints, 3) + std::ranges::count(ints, 4), 1000);
+  EXPECT_THROW((void)a.Int(2, 1), std::invalid_argument);
+}
+
+TEST(util_tests, check_data_cache) {
+#ifndef _WIN32
+  const auto dir =
+      std::filesystem::temp_directory_path() / ("ppc_cache_test_" + std::to_string(std::random_device{}()));
+  setenv("PPC_DATA_CACHE_DIR", dir.c_str(), 1);  // NOLINT(misc-include-cleaner)
+
+  int generated = 0;
+  auto generate = [&] {
+    generated++;
+    return ppc::util::Random(7).Vector<int>(1000, 0, 100);
+  };
+  auto first = ppc::util::LoadCached<int>("check_data_cache_7", 1, generate);
+  auto second = ppc::util::LoadCached<int>("check_data_cache_7", 1, generate);
+  EXPECT_EQ(generated, 1);
+  EXPECT_EQ(first.ToVector(), second.ToVector());
+  EXPECT_EQ(second.ToVector(), ppc::util::Random(7).Vector<int>(1000, 0, 100));
+
+  // mapped values may be changed in place without touching the cache
+  second.Data()[0] = -1;
+  EXPECT_EQ(ppc::util::LoadCached<int>("check_data_cache_7", 1, generate).Data()[0], first.Data()[0]);
+  // another version of the generator does not reuse the entry
+  auto changed = [&] {
+    generated++;
+    return std::vector<int>(5, 1);
+  };
+  EXPECT_EQ(ppc::util::LoadCached<int>("check_data_cache_7", 2, changed).ToVector(), std::vector<int>(5, 1));
+  EXPECT_EQ(generated, 2);
+  EXPECT_EQ(ppc::util::LoadCached<int>("check_data_cache_7", 2, generate).Size(), 5U);
+  // another element type does not reuse the entry
+  EXPECT_EQ(ppc::util::LoadCached<int64_t>("check_data_cache_7", 1, [] { return std::vector<int64_t>(3); }).Size(),
+            3U);
+  EXPECT_THROW((void)ppc::util::LoadCached<int>("../escape", 1, generate), std::invalid_argument);
+  // random inputs are keyed by name, count and seed
+  auto random = ppc::util::LoadCachedRandom<double>("check_data_cache", 100, -1.0, 1.0, 7);
+  EXPECT_TRUE(std::filesystem::exists(dir / "check_data_cache_100_seed7.bin"));
+  EXPECT_EQ(random.ToVector(), ppc::util::Random(7).Vector<double>(100, -1.0, 1.0));
+
+  setenv("PPC_DATA_CACHE", "off", 1);  // NOLINT(misc-include-cleaner)
+  (void)ppc::util::LoadCached<int>("check_data_cache_7", 1, generate);
+  EXPECT_EQ(generated, 3);
+  unsetenv("PPC_DATA_CACHE");     // NOLINT(misc-include-cleaner)
+  unsetenv("PPC_DATA_CACHE_DIR");  // NOLINT(misc-include-cleaner)
+  std::filesystem::remove_all(dir);
+#else
+  GTEST_SKIP();
+#endif
+}
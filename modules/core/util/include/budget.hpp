@@ -0,0 +1,58 @@
+#pragma once
+
+#include <functional>
+#include <istream>
+#include <map>
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace ppc::util {
+
+// Time limits of one task; unset fields fall back to the less specific entries of the config
+struct TaskBudget {
+  // limit of one pipeline run in functional tests (seconds)
+  std::optional<double> func_max_time;
+  // limit of the measured time in performance tests (seconds), 0 disables the cap
+  std::optional<double> perf_max_time;
+  // stored median of one run (seconds) and the allowed relative slowdown against it (0.1 means 10%)
+  std::optional<double> baseline_median;
+  std::optional<double> max_regression;
+
+  // fields of `other` that are set replace ours
+  void Merge(const TaskBudget &other);
+};
+
+// Per-task budgets, one entry per line:
+//
+//   # key       settings
+//   default     func_max_time=1 perf_max_time=10
+//   mpi/makadrai_a_sobel             perf_max_time=120
+//   mpi/makadrai_a_sobel:task_run    baseline_median=0.0421 max_regression=0.1
+//
+// Keys are "default", "<technology>/<task>" and "<technology>/<task>:<type of running>"; a lookup merges
+// them from the least to the most specific.
+class BudgetConfig {
+ public:
+  // throws std::invalid_argument on a malformed line
+  static BudgetConfig Parse(std::istream &in);
+  // throws std::runtime_error if the file cannot be read
+  static BudgetConfig Load(const std::string &path);
+
+  [[nodiscard]] TaskBudget Lookup(std::string_view technology, std::string_view task,
+                                  std::string_view type_of_running = {}) const;
+  [[nodiscard]] bool Empty() const { return entries_.empty(); }
+
+ private:
+  std::map<std::string, TaskBudget, std::less<>> entries_;
+};
+
+// Config from the file named by PPC_BUDGET_FILE, otherwise <project>/budgets.cfg if it exists; loaded once
+const BudgetConfig &GetBudgetConfig();
+// replace the loaded config, e.g. from a driver that computes budgets itself
+void SetBudgetConfig(BudgetConfig config);
+
+// Budget of the task whose test is running now (taken from the path of the test source)
+TaskBudget CurrentTaskBudget(std::string_view type_of_running = {});
+
+}  // namespace ppc::util
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <optional>
+#include <span>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "core/util/include/mapped_file.hpp"
+#include "core/util/include/random.hpp"
+
+namespace ppc::util {
+
+// Values of a dataset that is either mapped from the cache or held in memory
+template <class T>
+class CachedData {
+ public:
+  explicit CachedData(MappedFile file, std::size_t offset)
+      : file_(std::move(file)),
+        values_(reinterpret_cast<T *>(file_.Data() + offset), (file_.Size() - offset) / sizeof(T)) {}
+  explicit CachedData(std::vector<T> values) : owned_(std::move(values)), values_(owned_) {}
+
+  [[nodiscard]] std::span<T> Values() const { return values_; }
+  [[nodiscard]] T *Data() const { return values_.data(); }
+  [[nodiscard]] std::size_t Size() const { return values_.size(); }
+  [[nodiscard]] std::vector<T> ToVector() const { return {values_.begin(), values_.end()}; }
+
+ private:
+  MappedFile file_;
+  std::vector<T> owned_;
+  std::span<T> values_;
+};
+
+namespace detail {
+
+// directory of the cache or nullopt if caching is disabled
+std::optional<std::filesystem::path> DataCacheDir();
+// mapped cache entry and the offset of its values if the entry exists and matches the element size and the
+// generator version
+std::optional<std::pair<MappedFile, std::size_t>> OpenCacheEntry(const std::string &key, std::size_t element_size,
+                                                                  std::uint64_t generator_version);
+// false if the entry cannot be written
+bool StoreCacheEntry(const std::string &key, std::size_t element_size, std::uint64_t generator_version,
+                     const void *data, std::size_t count);
+
+}  // namespace detail
+
+// Dataset produced by `generate`, stored in the cache on the first call and memory-mapped on later ones, so
+// perf tests measure the algorithm instead of the data setup. The key names the file and must identify the
+// generator with all its parameters, seed included (letters, digits, '_', '-' and '.'). `generator_version` is
+// stored with the entry: bump it whenever the code of the generator changes, and entries written by the old
+// code are generated again instead of being reused.
+//
+// The cache lives in PPC_DATA_CACHE_DIR or <temp>/ppc_data_cache; PPC_DATA_CACHE=off disables it. Entries are
+// written to a temporary file and renamed, so concurrent processes may fill the same entry.
+template <class T>
+CachedData<T> LoadCached(const std::string &key, std::uint64_t generator_version,
+                         const std::function<std::vector<T>()> &generate) {
+  static_assert(std::is_trivially_copyable_v<T>, "cached values are stored as raw bytes");
+  if (!detail::DataCacheDir()) {
+    return CachedData<T>(generate());
+  }
+  if (auto entry = detail::OpenCacheEntry(key, sizeof(T), generator_version)) {
+    return CachedData<T>(std::move(entry->first), entry->second);
+  }
+  auto values = generate();
+  if (detail::StoreCacheEntry(key, sizeof(T), generator_version, values.data(), values.size())) {
+    if (auto entry = detail::OpenCacheEntry(key, sizeof(T), generator_version)) {
+      return CachedData<T>(std::move(entry->first), entry->second);
+    }
+  }
+  return CachedData<T>(std::move(values));
+}
+
+// `count` uniform values of Random(seed).Vector in the cache entry "<name>_<count>_seed<seed>", the usual input
+// of a perf test: every run works on the same data and pays for generating it only once
+template <class T>
+CachedData<T> LoadCachedRandom(const std::string &name, std::size_t count, T min, T max, std::uint64_t seed = 1) {
+  return LoadCached<T>(name + "_" + std::to_string(count) + "_seed" + std::to_string(seed), 1,
+                       [&] { return Random(seed).Vector<T>(count, min, max); });
+}
+
+}  // namespace ppc::util
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace ppc::util {
+
+// Contents of a file mapped into memory. The pages are private copies on write, so the data may be
+// modified in place without changing the file. Where mmap is not available the file is read into memory.
+class MappedFile {
+ public:
+  MappedFile() = default;
+  // throws std::runtime_error if the file cannot be opened or mapped
+  explicit MappedFile(const std::string &path);
+  MappedFile(const MappedFile &) = delete;
+  MappedFile &operator=(const MappedFile &) = delete;
+  MappedFile(MappedFile &&other) noexcept;
+  MappedFile &operator=(MappedFile &&other) noexcept;
+  ~MappedFile();
+
+  [[nodiscard]] std::byte *Data() const { return data_; }
+  [[nodiscard]] std::size_t Size() const { return size_; }
+
+ private:
+  void Reset();
+
+  std::byte *data_ = nullptr;
+  std::size_t size_ = 0;
+  bool mapped_ = false;
+  std::vector<std::byte> buffer_;
+};
+
+}  // namespace ppc::util
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace ppc::util {
+
+// Pseudo-random numbers that depend only on the seed: the same seed gives the same values with every
+// compiler and standard library, unlike std::uniform_*_distribution. xoshiro256** seeded through splitmix64.
+class Random {
+ public:
+  explicit Random(uint64_t seed);
+  // independent streams of one seed, e.g. Random(seed, "matrix") and Random(seed, "vector")
+  Random(uint64_t seed, std::string_view stream);
+
+  uint64_t Next();
+  // uniform in [min, max]
+  int64_t Int(int64_t min, int64_t max);
+  // uniform in [min, max)
+  double Real(double min, double max);
+
+  // uniform values in [min, max] for integers and [min, max) for floating point types
+  template <class T>
+  std::vector<T> Vector(std::size_t count, T min, T max) {
+    static_assert(std::is_arithmetic_v<T>);
+    std::vector<T> values(count);
+    for (auto &value : values) {
+      if constexpr (std::is_floating_point_v<T>) {
+        value = static_cast<T>(Real(min, max));
+      } else {
+        value = static_cast<T>(Int(static_cast<int64_t>(min), static_cast<int64_t>(max)));
+      }
+    }
+    return values;
+  }
+
+ private:
+  std::array<uint64_t, 4> state_{};
+};
+
+}  // namespace ppc::util
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace ppc::util {
+
+enum class PinPolicy : uint8_t {
+  kNone,
+  // threads fill the cores of one package before moving to the next
+  kCompact,
+  // consecutive threads go to different packages
+  kScatter,
+  // threads take the CPUs of ThreadConfig::cpu_list in order
+  kExplicit
+};
+
+// A CPU the process may run on
+struct CpuInfo {
+  int cpu = 0;
+  int package = 0;
+  int core = 0;
+  int node = 0;
+};
+
+// Thread count and placement shared by the OpenMP, TBB, std::thread and "all" implementations.
+//
+// Read from the environment:
+//   PPC_NUM_THREADS (or OMP_NUM_THREADS)  count of threads per process
+//   PPC_PIN        none | compact | scatter | explicit CPU list such as "0,2,8-11"
+//   PPC_NUMA_NODE  use only the CPUs of this NUMA node
+// Processes of an MPI job on the same node split the selected CPUs into disjoint equal slices, so ranks
+// do not oversubscribe cores or migrate onto each other.
+struct ThreadConfig {
+  int num_threads = 1;
+  PinPolicy pin = PinPolicy::kNone;
+  std::vector<int> cpu_list;
+  int numa_node = -1;
+  // position of the process among the processes of the job on this node
+  int local_rank = 0;
+  int local_ranks = 1;
+  // CPUs for threads 0, 1, ... of this process (repeating if there are more threads); empty without pinning
+  std::vector<int> cpus;
+
+  // throws std::invalid_argument on malformed values
+  static ThreadConfig FromEnv();
+  // CPU for a thread or -1 without pinning
+  [[nodiscard]] int CpuFor(int thread) const;
+};
+
+// "0,2,8-11" -> {0, 2, 8, 9, 10, 11}; throws std::invalid_argument
+std::vector<int> ParseCpuList(const std::string &list);
+// allowed CPUs of the process with their package/core/NUMA node from sysfs (Linux); empty elsewhere
+std::vector<CpuInfo> ReadCpuTopology();
+// CPUs of this process for the policy, NUMA node and local rank of the config
+std::vector<int> SelectCpus(const ThreadConfig &config, const std::vector<CpuInfo> &topology);
+
+// Config of this process, read from the environment on first use
+const ThreadConfig &GetThreadConfig();
+void SetThreadConfig(ThreadConfig config);
+
+// Bind the calling thread to the CPU of thread `thread` (and its memory to the NUMA node if one is set);
+// returns false if pinning is off or not supported. The binding outlives the caller's work, so call it only on
+// threads the task owns (pool workers), never on the thread that runs the task
+bool PinCurrentThread(int thread);
+
+}  // namespace ppc::util
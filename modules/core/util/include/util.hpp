@@ -4,6 +4,14 @@
 namespace ppc::util {
 
 std::string GetAbsolutePath(const std::string &relative_path);
+// PPC_NUM_THREADS, otherwise OMP_NUM_THREADS, otherwise 1
 int GetPPCNumThreads();
+// value of environment variable or empty string if it is not set
+std::string GetEnv(const std::string &name);
+// count of processes in the job as reported by the MPI launcher (1 if not launched by mpirun/mpiexec)
+int GetNumProcesses();
+// technology and task directory names from the path of a test source:
+// "<...>/tasks/<technology>/<task>/perf_tests/main.cpp" or "<...>/modules/<technology>/<task>/func_tests/..."
+void ParseTestPath(const std::string &test_file, std::string &technology, std::string &task);
 
 }  // namespace ppc::util
@@ -0,0 +1,140 @@
+#include "core/util/include/budget.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <istream>
+#include <optional>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <utility>
+
+#include "core/util/include/util.hpp"
+
+void ppc::util::TaskBudget::Merge(const TaskBudget &other) {
+  for (auto field : {&TaskBudget::func_max_time, &TaskBudget::perf_max_time, &TaskBudget::baseline_median,
+                     &TaskBudget::max_regression}) {
+    if (other.*field) {
+      this->*field = other.*field;
+    }
+  }
+}
+
+ppc::util::BudgetConfig ppc::util::BudgetConfig::Parse(std::istream &in) {
+  BudgetConfig config;
+  std::string line;
+  for (std::size_t line_number = 1; std::getline(in, line); line_number++) {
+    line = line.substr(0, line.find('#'));
+    std::istringstream fields(line);
+    std::string key;
+    if (!(fields >> key)) {
+      continue;
+    }
+    auto &budget = config.entries_[key];
+    std::string setting;
+    while (fields >> setting) {
+      const auto error = "budget config line " + std::to_string(line_number) + ": ";
+      const auto eq = setting.find('=');
+      if (eq == std::string::npos) {
+        throw std::invalid_argument(error + "expected name=value, got '" + setting + "'");
+      }
+      const auto name = setting.substr(0, eq);
+      double value = 0.0;
+      try {
+        std::size_t parsed = 0;
+        value = std::stod(setting.substr(eq + 1), &parsed);
+        if (parsed != setting.size() - eq - 1) {
+          throw std::invalid_argument(setting);
+        }
+      } catch (const std::exception &) {
+        throw std::invalid_argument(error + "'" + setting + "' is not a number");
+      }
+      if (value < 0.0) {
+        throw std::invalid_argument(error + "'" + setting + "' is negative");
+      }
+      if (name == "func_max_time") {
+        budget.func_max_time = value;
+      } else if (name == "perf_max_time") {
+        budget.perf_max_time = value;
+      } else if (name == "baseline_median") {
+        budget.baseline_median = value;
+      } else if (name == "max_regression") {
+        budget.max_regression = value;
+      } else {
+        throw std::invalid_argument(error + "unknown setting '" + name + "'");
+      }
+    }
+  }
+  return config;
+}
+
+ppc::util::BudgetConfig ppc::util::BudgetConfig::Load(const std::string &path) {
+  std::ifstream file(path);
+  if (!file) {
+    throw std::runtime_error("Cannot read budget config " + path);
+  }
+  return Parse(file);
+}
+
+ppc::util::TaskBudget ppc::util::BudgetConfig::Lookup(std::string_view technology, std::string_view task,
+                                                      std::string_view type_of_running) const {
+  TaskBudget budget;
+  auto merge = [&](const std::string &key) {
+    auto it = entries_.find(key);
+    if (it != entries_.end()) {
+      budget.Merge(it->second);
+    }
+  };
+  const auto task_key = std::string(technology) + "/" + std::string(task);
+  merge("default");
+  merge(task_key);
+  if (!type_of_running.empty()) {
+    merge(task_key + ":" + std::string(type_of_running));
+  }
+  return budget;
+}
+
+namespace {
+
+ppc::util::BudgetConfig LoadDefaultConfig() {
+  auto path = ppc::util::GetEnv("PPC_BUDGET_FILE");
+  if (path.empty()) {
+    path = std::string(PPC_PATH_TO_PROJECT) + "/budgets.cfg";
+    std::error_code ec;
+    if (!std::filesystem::exists(path, ec)) {
+      return {};
+    }
+  }
+  return ppc::util::BudgetConfig::Load(path);
+}
+
+ppc::util::BudgetConfig &Config() {
+  static ppc::util::BudgetConfig config = LoadDefaultConfig();
+  return config;
+}
+
+}  // namespace
+
+const ppc::util::BudgetConfig &ppc::util::GetBudgetConfig() { return Config(); }
+
+void ppc::util::SetBudgetConfig(BudgetConfig config) { Config() = std::move(config); }
+
+ppc::util::TaskBudget ppc::util::CurrentTaskBudget(std::string_view type_of_running) {
+  const auto &config = GetBudgetConfig();
+  if (config.Empty()) {
+    return {};
+  }
+  std::string technology;
+  std::string task;
+  const auto *test_info = ::testing::UnitTest::GetInstance()->current_test_info();
+  if (test_info != nullptr) {
+    ParseTestPath(test_info->file(), technology, task);
+  }
+  return config.Lookup(technology, task, type_of_running);
+}
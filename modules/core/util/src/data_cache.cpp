@@ -0,0 +1,126 @@
+#include "core/util/include/data_cache.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <utility>
+
+#include "core/util/include/mapped_file.hpp"
+#include "core/util/include/util.hpp"
+
+namespace {
+
+constexpr std::array<char, 8> kMagic = {'P', 'P', 'C', 'C', 'A', 'C', 'H', 'E'};
+constexpr uint64_t kVersion = 2;
+// the values start at a cache line boundary of the page-aligned mapping
+constexpr std::size_t kHeaderSize = 64;
+
+struct Header {
+  std::array<char, 8> magic{};
+  uint64_t version = 0;
+  uint64_t element_size = 0;
+  uint64_t count = 0;
+  uint64_t generator_version = 0;
+};
+static_assert(sizeof(Header) <= kHeaderSize);
+
+std::filesystem::path EntryPath(const std::string &key) {
+  const bool valid = !key.empty() && std::ranges::all_of(key, [](char c) {
+    return std::isalnum(static_cast<unsigned char>(c)) != 0 || c == '_' || c == '-' || c == '.';
+  });
+  if (!valid || key.front() == '.') {
+    throw std::invalid_argument("Data cache key '" + key + "' must consist of letters, digits, '_', '-' and '.'");
+  }
+  return *ppc::util::detail::DataCacheDir() / (key + ".bin");
+}
+
+}  // namespace
+
+std::optional<std::filesystem::path> ppc::util::detail::DataCacheDir() {
+  const auto mode = GetEnv("PPC_DATA_CACHE");
+  if (mode == "off" || mode == "0") {
+    return std::nullopt;
+  }
+  const auto dir = GetEnv("PPC_DATA_CACHE_DIR");
+  if (!dir.empty()) {
+    return std::filesystem::path(dir);
+  }
+  std::error_code ec;
+  auto temp = std::filesystem::temp_directory_path(ec);
+  if (ec) {
+    return std::nullopt;
+  }
+  return temp / "ppc_data_cache";
+}
+
+std::optional<std::pair<ppc::util::MappedFile, std::size_t>> ppc::util::detail::OpenCacheEntry(
+    const std::string &key, std::size_t element_size, std::uint64_t generator_version) {
+  const auto path = EntryPath(key);
+  std::error_code ec;
+  if (!std::filesystem::is_regular_file(path, ec)) {
+    return std::nullopt;
+  }
+  MappedFile file;
+  try {
+    file = MappedFile(path.string());
+  } catch (const std::exception &) {
+    return std::nullopt;
+  }
+  Header header;
+  if (file.Size() < kHeaderSize) {
+    return std::nullopt;
+  }
+  std::memcpy(&header, file.Data(), sizeof(header));
+  // entries of another layout or generator, or cut short by a crash are generated again
+  if (header.magic != kMagic || header.version != kVersion || header.element_size != element_size ||
+      header.generator_version != generator_version || file.Size() != kHeaderSize + (header.count * element_size)) {
+    return std::nullopt;
+  }
+  return std::make_pair(std::move(file), kHeaderSize);
+}
+
+bool ppc::util::detail::StoreCacheEntry(const std::string &key, std::size_t element_size,
+                                        std::uint64_t generator_version, const void *data, std::size_t count) {
+  const auto path = EntryPath(key);
+  std::error_code ec;
+  std::filesystem::create_directories(path.parent_path(), ec);
+  if (ec) {
+    return false;
+  }
+  auto temp = path;
+  temp += ".tmp" + std::to_string(std::random_device{}());
+  {
+    std::ofstream file(temp, std::ios::binary);
+    std::array<char, kHeaderSize> header_bytes{};
+    const Header header{.magic = kMagic,
+                        .version = kVersion,
+                        .element_size = element_size,
+                        .count = count,
+                        .generator_version = generator_version};
+    std::memcpy(header_bytes.data(), &header, sizeof(header));
+    file.write(header_bytes.data(), header_bytes.size());
+    file.write(static_cast<const char *>(data), static_cast<std::streamsize>(count * element_size));
+    file.close();
+    if (!file) {
+      std::filesystem::remove(temp, ec);
+      return false;
+    }
+  }
+  std::filesystem::rename(temp, path, ec);
+  if (ec) {
+    std::filesystem::remove(temp, ec);
+    return false;
+  }
+  return true;
+}
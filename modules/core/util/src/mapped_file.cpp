@@ -0,0 +1,79 @@
+#include "core/util/include/mapped_file.hpp"
+
+#include <cstddef>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+ppc::util::MappedFile::MappedFile(const std::string &path) {
+#ifndef _WIN32
+  const int fd = open(path.c_str(), O_RDONLY);
+  if (fd < 0) {
+    throw std::runtime_error("Cannot open " + path);
+  }
+  struct stat info{};
+  if (fstat(fd, &info) != 0) {
+    close(fd);
+    throw std::runtime_error("Cannot stat " + path);
+  }
+  size_ = static_cast<std::size_t>(info.st_size);
+  if (size_ > 0) {
+    void *data = mmap(nullptr, size_, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    if (data == MAP_FAILED) {
+      close(fd);
+      throw std::runtime_error("Cannot map " + path);
+    }
+    data_ = static_cast<std::byte *>(data);
+    mapped_ = true;
+  }
+  // the mapping stays valid after the descriptor is closed
+  close(fd);
+#else
+  std::ifstream file(path, std::ios::binary | std::ios::ate);
+  if (!file) {
+    throw std::runtime_error("Cannot open " + path);
+  }
+  buffer_.resize(static_cast<std::size_t>(file.tellg()));
+  file.seekg(0);
+  if (!file.read(reinterpret_cast<char *>(buffer_.data()), static_cast<std::streamsize>(buffer_.size()))) {
+    throw std::runtime_error("Cannot read " + path);
+  }
+  data_ = buffer_.data();
+  size_ = buffer_.size();
+#endif
+}
+
+ppc::util::MappedFile::MappedFile(MappedFile &&other) noexcept { *this = std::move(other); }
+
+ppc::util::MappedFile &ppc::util::MappedFile::operator=(MappedFile &&other) noexcept {
+  if (this != &other) {
+    Reset();
+    data_ = std::exchange(other.data_, nullptr);
+    size_ = std::exchange(other.size_, 0);
+    mapped_ = std::exchange(other.mapped_, false);
+    buffer_ = std::move(other.buffer_);
+  }
+  return *this;
+}
+
+ppc::util::MappedFile::~MappedFile() { Reset(); }
+
+void ppc::util::MappedFile::Reset() {
+#ifndef _WIN32
+  if (mapped_) {
+    munmap(data_, size_);
+  }
+#endif
+  data_ = nullptr;
+  size_ = 0;
+  mapped_ = false;
+  buffer_.clear();
+}
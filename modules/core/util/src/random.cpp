@@ -0,0 +1,72 @@
+#include "core/util/include/random.hpp"
+
+#include <cstdint>
+#include <stdexcept>
+#include <string_view>
+
+namespace {
+
+uint64_t SplitMix64(uint64_t &x) {
+  uint64_t z = (x += 0x9e3779b97f4a7c15ULL);
+  z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+  z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+  return z ^ (z >> 31);
+}
+
+uint64_t Rotl(uint64_t x, int k) { return (x << k) | (x >> (64 - k)); }
+
+// FNV-1a, stable across platforms unlike std::hash
+uint64_t HashStream(std::string_view stream) {
+  uint64_t hash = 0xcbf29ce484222325ULL;
+  for (const char c : stream) {
+    hash = (hash ^ static_cast<unsigned char>(c)) * 0x100000001b3ULL;
+  }
+  return hash;
+}
+
+}  // namespace
+
+ppc::util::Random::Random(uint64_t seed) {
+  for (auto &word : state_) {
+    word = SplitMix64(seed);
+  }
+}
+
+ppc::util::Random::Random(uint64_t seed, std::string_view stream) : Random(seed ^ HashStream(stream)) {}
+
+uint64_t ppc::util::Random::Next() {
+  const uint64_t result = Rotl(state_[1] * 5, 7) * 9;
+  const uint64_t t = state_[1] << 17;
+  state_[2] ^= state_[0];
+  state_[3] ^= state_[1];
+  state_[1] ^= state_[2];
+  state_[0] ^= state_[3];
+  state_[2] ^= t;
+  state_[3] = Rotl(state_[3], 45);
+  return result;
+}
+
+int64_t ppc::util::Random::Int(int64_t min, int64_t max) {
+  if (min > max) {
+    throw std::invalid_argument("Random::Int: min is greater than max");
+  }
+  const uint64_t range = static_cast<uint64_t>(max) - static_cast<uint64_t>(min) + 1;
+  if (range == 0) {
+    return static_cast<int64_t>(Next());
+  }
+  // reject the lowest values so that every residue is equally likely
+  const uint64_t threshold = (0 - range) % range;
+  uint64_t x = Next();
+  while (x < threshold) {
+    x = Next();
+  }
+  return static_cast<int64_t>(static_cast<uint64_t>(min) + (x % range));
+}
+
+double ppc::util::Random::Real(double min, double max) {
+  if (!(min <= max)) {
+    throw std::invalid_argument("Random::Real: min is greater than max");
+  }
+  const double unit = static_cast<double>(Next() >> 11) * 0x1.0p-53;
+  return min + (unit * (max - min));
+}
@@ -0,0 +1,263 @@
+#include "core/util/include/thread_config.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <fstream>
+#include <initializer_list>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "core/util/include/util.hpp"
+
+#ifdef __linux__
+#include <sched.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+int ParseInt(const std::string &value, const std::string &what) {
+  std::size_t parsed = 0;
+  int result = 0;
+  try {
+    result = std::stoi(value, &parsed);
+  } catch (const std::exception &) {
+    parsed = 0;
+  }
+  if (parsed == 0 || parsed != value.size()) {
+    throw std::invalid_argument(what + ": '" + value + "' is not a number");
+  }
+  return result;
+}
+
+// first set variable of the launchers that report it
+int FirstEnvInt(std::initializer_list<const char *> names, int fallback) {
+  for (const auto *name : names) {
+    const auto value = ppc::util::GetEnv(name);
+    if (!value.empty()) {
+      return std::atoi(value.c_str());
+    }
+  }
+  return fallback;
+}
+
+int ReadSysfsInt(const std::string &path, int fallback) {
+  std::ifstream file(path);
+  int value = 0;
+  return (file >> value) ? value : fallback;
+}
+
+ppc::util::ThreadConfig &Config() {
+  static ppc::util::ThreadConfig config = ppc::util::ThreadConfig::FromEnv();
+  return config;
+}
+
+}  // namespace
+
+std::vector<int> ppc::util::ParseCpuList(const std::string &list) {
+  std::vector<int> cpus;
+  std::size_t begin = 0;
+  while (begin <= list.size()) {
+    auto end = list.find(',', begin);
+    if (end == std::string::npos) {
+      end = list.size();
+    }
+    const auto item = list.substr(begin, end - begin);
+    const auto dash = item.find('-');
+    if (dash == std::string::npos) {
+      cpus.push_back(ParseInt(item, "CPU list"));
+    } else {
+      const int first = ParseInt(item.substr(0, dash), "CPU list");
+      const int last = ParseInt(item.substr(dash + 1), "CPU list");
+      if (first > last) {
+        throw std::invalid_argument("CPU list: range '" + item + "' is reversed");
+      }
+      for (int cpu = first; cpu <= last; cpu++) {
+        cpus.push_back(cpu);
+      }
+    }
+    begin = end + 1;
+  }
+  if (std::ranges::any_of(cpus, [](int cpu) { return cpu < 0; })) {
+    throw std::invalid_argument("CPU list: '" + list + "' contains a negative CPU");
+  }
+  return cpus;
+}
+
+ppc::util::ThreadConfig ppc::util::ThreadConfig::FromEnv() {
+  ThreadConfig config;
+  config.num_threads = std::max(GetPPCNumThreads(), 1);
+
+  const auto pin = GetEnv("PPC_PIN");
+  if (pin.empty() || pin == "none") {
+    config.pin = PinPolicy::kNone;
+  } else if (pin == "compact") {
+    config.pin = PinPolicy::kCompact;
+  } else if (pin == "scatter") {
+    config.pin = PinPolicy::kScatter;
+  } else {
+    config.pin = PinPolicy::kExplicit;
+    config.cpu_list = ParseCpuList(pin);
+  }
+  const auto numa_node = GetEnv("PPC_NUMA_NODE");
+  if (!numa_node.empty()) {
+    config.numa_node = ParseInt(numa_node, "PPC_NUMA_NODE");
+  }
+
+  // Open MPI, MPICH/Intel MPI (Hydra), Slurm
+  config.local_ranks = std::max(
+      FirstEnvInt({"OMPI_COMM_WORLD_LOCAL_SIZE", "MPI_LOCALNRANKS", "SLURM_NTASKS_PER_NODE"}, 1), 1);
+  config.local_rank = std::clamp(FirstEnvInt({"OMPI_COMM_WORLD_LOCAL_RANK", "MPI_LOCALRANKID", "SLURM_LOCALID"}, 0),
+                                 0, config.local_ranks - 1);
+
+  if (config.pin != PinPolicy::kNone) {
+    config.cpus = SelectCpus(config, ReadCpuTopology());
+  }
+  return config;
+}
+
+int ppc::util::ThreadConfig::CpuFor(int thread) const {
+  if (cpus.empty() || thread < 0) {
+    return -1;
+  }
+  return cpus[static_cast<std::size_t>(thread) % cpus.size()];
+}
+
+std::vector<ppc::util::CpuInfo> ppc::util::ReadCpuTopology() {
+  std::vector<CpuInfo> topology;
+#ifdef __linux__
+  cpu_set_t allowed;
+  CPU_ZERO(&allowed);
+  if (sched_getaffinity(0, sizeof(allowed), &allowed) != 0) {
+    return topology;
+  }
+  std::map<int, int> node_of_cpu;
+  for (int node = 0;; node++) {
+    std::ifstream file("/sys/devices/system/node/node" + std::to_string(node) + "/cpulist");
+    std::string list;
+    if (!(file >> list)) {
+      break;
+    }
+    for (int cpu : ParseCpuList(list)) {
+      node_of_cpu[cpu] = node;
+    }
+  }
+  for (int cpu = 0; cpu < CPU_SETSIZE; cpu++) {
+    if (CPU_ISSET(cpu, &allowed)) {
+      const auto dir = "/sys/devices/system/cpu/cpu" + std::to_string(cpu) + "/topology/";
+      topology.push_back({.cpu = cpu,
+                          .package = ReadSysfsInt(dir + "physical_package_id", 0),
+                          .core = ReadSysfsInt(dir + "core_id", cpu),
+                          .node = node_of_cpu.contains(cpu) ? node_of_cpu[cpu] : 0});
+    }
+  }
+#endif
+  return topology;
+}
+
+std::vector<int> ppc::util::SelectCpus(const ThreadConfig &config, const std::vector<CpuInfo> &topology) {
+  if (config.pin == PinPolicy::kNone) {
+    return {};
+  }
+  std::vector<CpuInfo> pool;
+  if (config.pin == PinPolicy::kExplicit) {
+    for (int cpu : config.cpu_list) {
+      auto it = std::ranges::find(topology, cpu, &CpuInfo::cpu);
+      pool.push_back(it != topology.end() ? *it : CpuInfo{.cpu = cpu, .package = 0, .core = cpu, .node = 0});
+    }
+  } else {
+    // one hardware thread of every core of a package first, their siblings after them
+    std::map<std::pair<int, int>, int> siblings;
+    std::vector<std::tuple<int, int, int, CpuInfo>> order;
+    for (const auto &info : topology) {
+      order.emplace_back(info.package, siblings[{info.package, info.core}]++, info.core, info);
+    }
+    std::ranges::sort(order, [](const auto &a, const auto &b) {
+      return std::tie(std::get<0>(a), std::get<1>(a), std::get<2>(a), std::get<3>(a).cpu) <
+             std::tie(std::get<0>(b), std::get<1>(b), std::get<2>(b), std::get<3>(b).cpu);
+    });
+    for (const auto &entry : order) {
+      pool.push_back(std::get<3>(entry));
+    }
+  }
+  if (config.numa_node >= 0) {
+    std::erase_if(pool, [&](const CpuInfo &info) { return info.node != config.numa_node; });
+  }
+  if (pool.empty()) {
+    return {};
+  }
+
+  // disjoint contiguous slice per process on the node
+  const auto ranks = static_cast<std::size_t>(std::max(config.local_ranks, 1));
+  const auto rank = static_cast<std::size_t>(std::clamp(config.local_rank, 0, config.local_ranks - 1));
+  std::vector<CpuInfo> slice;
+  if (pool.size() >= ranks) {
+    slice.assign(pool.begin() + static_cast<std::ptrdiff_t>(rank * pool.size() / ranks),
+                 pool.begin() + static_cast<std::ptrdiff_t>((rank + 1) * pool.size() / ranks));
+  } else {
+    slice.push_back(pool[rank % pool.size()]);
+  }
+
+  std::vector<int> cpus;
+  cpus.reserve(slice.size());
+  if (config.pin == PinPolicy::kScatter) {
+    // round-robin over packages, keeping the compact order inside each package
+    std::map<int, std::vector<int>> by_package;
+    for (const auto &info : slice) {
+      by_package[info.package].push_back(info.cpu);
+    }
+    for (std::size_t i = 0; cpus.size() < slice.size(); i++) {
+      for (const auto &[package, package_cpus] : by_package) {
+        if (i < package_cpus.size()) {
+          cpus.push_back(package_cpus[i]);
+        }
+      }
+    }
+  } else {
+    for (const auto &info : slice) {
+      cpus.push_back(info.cpu);
+    }
+  }
+  return cpus;
+}
+
+const ppc::util::ThreadConfig &ppc::util::GetThreadConfig() { return Config(); }
+
+void ppc::util::SetThreadConfig(ThreadConfig config) { Config() = std::move(config); }
+
+bool ppc::util::PinCurrentThread(int thread) {
+  const auto &config = GetThreadConfig();
+  const int cpu = config.CpuFor(thread);
+  if (cpu < 0) {
+    return false;
+  }
+#ifdef __linux__
+  if (cpu >= CPU_SETSIZE) {
+    return false;
+  }
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  CPU_SET(cpu, &set);
+  // with pid 0 Linux changes the calling thread only
+  if (sched_setaffinity(0, sizeof(set), &set) != 0) {
+    return false;
+  }
+#ifdef SYS_set_mempolicy
+  if (config.numa_node >= 0 && config.numa_node < static_cast<int>(8 * sizeof(unsigned long))) {
+    // MPOL_PREFERRED: allocate on the node while it has free memory
+    constexpr int kMpolPreferred = 1;
+    const unsigned long node_mask = 1UL << config.numa_node;
+    syscall(SYS_set_mempolicy, kMpolPreferred, &node_mask, 8 * sizeof(unsigned long));
+  }
+#endif
+  return true;
+#else
+  return false;
+#endif
+}
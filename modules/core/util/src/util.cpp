@@ -1,5 +1,6 @@
 #include "core/util/include/util.hpp"
 
+#include <algorithm>
 #include <cstdlib>
 #ifdef _WIN32
 #include <cstdint>
@@ -8,8 +9,10 @@
 #include <vector>
 #endif
 
+#include <cstddef>
 #include <filesystem>
 #include <string>
+#include <vector>
 
 std::string ppc::util::GetAbsolutePath(const std::string &relative_path) {
   const std::filesystem::path path = std::string(PPC_PATH_TO_PROJECT) + "/tasks/" + relative_path;
@@ -17,6 +20,10 @@ std::string ppc::util::GetAbsolutePath(const std::string &relative_path) {
 }
 
 int ppc::util::GetPPCNumThreads() {
+  const auto ppc_env = GetEnv("PPC_NUM_THREADS");
+  if (!ppc_env.empty()) {
+    return std::atoi(ppc_env.c_str());
+  }
 #ifdef _WIN32
   size_t len;
   char omp_env[100];
@@ -30,3 +37,46 @@ int ppc::util::GetPPCNumThreads() {
   int num_threads = (omp_env != nullptr) ? std::atoi(omp_env) : 1;
   return num_threads;
 }
+
+std::string ppc::util::GetEnv(const std::string &name) {
+#ifdef _WIN32
+  size_t len;
+  char value[4096];
+  errno_t err = getenv_s(&len, value, sizeof(value), name.c_str());
+  if (err != 0 || len == 0) {
+    return {};
+  }
+  return value;
+#else
+  const char *value = std::getenv(name.c_str());
+  return (value != nullptr) ? value : std::string();
+#endif
+}
+
+int ppc::util::GetNumProcesses() {
+  // Open MPI, MPICH/Intel MPI (Hydra) and MS-MPI launchers
+  for (const auto *name : {"OMPI_COMM_WORLD_SIZE", "PMI_SIZE", "PMIX_SIZE", "MPI_LOCALNRANKS"}) {
+    const auto value = GetEnv(name);
+    if (!value.empty()) {
+      return std::max(std::atoi(value.c_str()), 1);
+    }
+  }
+  return 1;
+}
+
+void ppc::util::ParseTestPath(const std::string &test_file, std::string &technology, std::string &task) {
+  std::vector<std::string> parts;
+  for (const auto &part : std::filesystem::path(test_file)) {
+    parts.emplace_back(part.string());
+  }
+  for (std::size_t i = parts.size(); i >= 3; i--) {
+    const auto &root = parts[i - 3];
+    if (root == "tasks" || root == "modules") {
+      technology = parts[i - 2];
+      task = parts[i - 1];
+      return;
+    }
+  }
+  technology = "unknown";
+  task = std::filesystem::path(test_file).stem().string();
+}
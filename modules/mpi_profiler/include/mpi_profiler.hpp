@@ -0,0 +1,56 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <ostream>
+#include <string>
+#include <utility>
+
+// MPI profiler based on the standard PMPI interface. Linking mpi_profiler_lib into an executable replaces
+// MPI_Send, MPI_Bcast, MPI_Gatherv, ... with wrappers that count calls, bytes and time per call site and forward
+// to the PMPI_* entry points. In gtest executables the breakdown of every test is printed after the test.
+// Call sites are resolved from a backtrace only with PPC_MPI_PROFILE_CALLERS=1, otherwise calls are
+// aggregated per operation and the call site is "-".
+namespace ppc::mpi_profiler {
+
+struct CallStats {
+  std::uint64_t calls = 0;
+  std::uint64_t bytes = 0;
+  double time_sec = 0.0;
+};
+
+// (MPI operation, first calling function outside of MPI, Boost and the standard library or "-") -> statistics
+using Profile = std::map<std::pair<std::string, std::string>, CallStats>;
+
+// Calls recorded on this process since the last Reset()
+Profile Snapshot();
+void Reset();
+
+// Collective over MPI_COMM_WORLD: rank 0 prints the calls of all processes aggregated per call site
+// and the share of wall_time_sec each process spent inside MPI
+void PrintSummary(std::ostream &out, const std::string &title, double wall_time_sec);
+
+namespace detail {
+
+// Records one MPI call of the enclosing wrapper; nested MPI calls made by the MPI library itself are not counted
+class ScopedCall {
+ public:
+  ScopedCall(const char *operation, std::uint64_t bytes);
+  ScopedCall(const ScopedCall &) = delete;
+  ScopedCall &operator=(const ScopedCall &) = delete;
+  ScopedCall(ScopedCall &&) = delete;
+  ScopedCall &operator=(ScopedCall &&) = delete;
+  ~ScopedCall();
+
+ private:
+  const char *operation_;
+  std::uint64_t bytes_;
+  bool active_;
+  std::string caller_;
+  std::chrono::steady_clock::time_point start_;
+};
+
+}  // namespace detail
+
+}  // namespace ppc::mpi_profiler
@@ -0,0 +1,226 @@
+#include "mpi_profiler/include/mpi_profiler.hpp"
+
+#include <cxxabi.h>
+#include <dlfcn.h>
+#include <execinfo.h>
+#include <mpi.h>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace {
+
+std::mutex profile_mutex;
+ppc::mpi_profiler::Profile profile;
+std::unordered_map<void *, std::string> symbol_cache;
+thread_local int call_depth = 0;
+
+// Walking the stack on every call is too slow for fine-grained send/recv loops, so call sites are opt-in
+bool CaptureCallers() {
+  static const bool kCapture = [] {
+    const char *value = std::getenv("PPC_MPI_PROFILE_CALLERS");
+    return value != nullptr && std::string_view(value) != "0" && std::string_view(value) != "off";
+  }();
+  return kCapture;
+}
+
+// "void ns::Class<int>::Method<char>(int) const" -> "ns::Class<int>::Method<char>"
+std::string StripSignature(const std::string &name) {
+  int depth = 0;
+  std::size_t begin = 0;
+  for (std::size_t i = 1; i < name.size(); i++) {
+    if (name[i] == '<') {
+      depth++;
+    } else if (name[i] == '>') {
+      depth--;
+    } else if (name[i] == ' ' && depth == 0) {
+      begin = i + 1;
+    } else if (name[i] == '(' && depth == 0) {
+      return name.substr(begin, i - begin);
+    }
+  }
+  return name.substr(begin);
+}
+
+// Symbols of the executable are visible only when it is linked with exported symbols (ENABLE_EXPORTS)
+const std::string &SymbolName(void *address) {
+  auto it = symbol_cache.find(address);
+  if (it != symbol_cache.end()) {
+    return it->second;
+  }
+  std::string name;
+  Dl_info info{};
+  if (dladdr(address, &info) != 0 && info.dli_sname != nullptr) {
+    int status = 0;
+    std::unique_ptr<char, decltype(&std::free)> demangled(
+        abi::__cxa_demangle(info.dli_sname, nullptr, nullptr, &status), &std::free);
+    name = StripSignature(status == 0 ? demangled.get() : info.dli_sname);
+  }
+  return symbol_cache.emplace(address, std::move(name)).first->second;
+}
+
+bool IsLibraryFrame(std::string_view name) {
+  constexpr std::array<std::string_view, 10> kPrefixes = {
+      "boost::", "std::", "__gnu_cxx::", "testing::", "ppc::mpi_profiler::", "MPI_", "PMPI_", "ompi_", "mca_", "__"};
+  return name.empty() ||
+         std::ranges::any_of(kPrefixes, [&](std::string_view prefix) { return name.starts_with(prefix); });
+}
+
+// The first named frame above the MPI wrapper that belongs neither to MPI nor to Boost.MPI or the standard library
+std::string ResolveCaller() {
+  std::array<void *, 48> frames{};
+  const int depth = backtrace(frames.data(), static_cast<int>(frames.size()));
+  const std::lock_guard lock(profile_mutex);
+  for (int i = 1; i < depth; i++) {
+    const auto &name = SymbolName(frames[i]);
+    if (!IsLibraryFrame(name)) {
+      return name;
+    }
+  }
+  return "<unknown>";
+}
+
+struct SiteSummary {
+  std::uint64_t calls = 0;
+  std::uint64_t bytes = 0;
+  double time_sum = 0.0;
+  double time_max = 0.0;
+};
+
+std::string FormatBytes(std::uint64_t bytes) {
+  constexpr std::array<const char *, 4> kUnits = {"B", "KiB", "MiB", "GiB"};
+  auto value = static_cast<double>(bytes);
+  std::size_t unit = 0;
+  while (value >= 1024.0 && unit + 1 < kUnits.size()) {
+    value /= 1024.0;
+    unit++;
+  }
+  std::ostringstream out;
+  out << std::fixed << std::setprecision(unit == 0 ? 0 : 1) << value << ' ' << kUnits[unit];
+  return out.str();
+}
+
+}  // namespace
+
+ppc::mpi_profiler::detail::ScopedCall::ScopedCall(const char *operation, std::uint64_t bytes)
+    : operation_(operation), bytes_(bytes), active_(call_depth++ == 0) {
+  if (active_) {
+    caller_ = CaptureCallers() ? ResolveCaller() : "-";
+    start_ = std::chrono::steady_clock::now();
+  }
+}
+
+ppc::mpi_profiler::detail::ScopedCall::~ScopedCall() {
+  call_depth--;
+  if (!active_) {
+    return;
+  }
+  const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start_;
+  const std::lock_guard lock(profile_mutex);
+  auto &stats = profile[{operation_, std::move(caller_)}];
+  stats.calls++;
+  stats.bytes += bytes_;
+  stats.time_sec += elapsed.count();
+}
+
+ppc::mpi_profiler::Profile ppc::mpi_profiler::Snapshot() {
+  const std::lock_guard lock(profile_mutex);
+  return profile;
+}
+
+void ppc::mpi_profiler::Reset() {
+  const std::lock_guard lock(profile_mutex);
+  profile.clear();
+}
+
+void ppc::mpi_profiler::PrintSummary(std::ostream &out, const std::string &title, double wall_time_sec) {
+  int rank = 0;
+  int size = 1;
+  PMPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  PMPI_Comm_size(MPI_COMM_WORLD, &size);
+
+  // One line per call site: operation, caller, calls, bytes, time
+  std::ostringstream local;
+  local << std::setprecision(17);
+  for (const auto &[site, stats] : Snapshot()) {
+    local << site.first << '\t' << site.second << '\t' << stats.calls << '\t' << stats.bytes << '\t' << stats.time_sec
+          << '\n';
+  }
+  const std::string data = local.str();
+  int length = static_cast<int>(data.size());
+  std::vector<int> lengths(size);
+  std::vector<double> walls(size);
+  PMPI_Gather(&length, 1, MPI_INT, lengths.data(), 1, MPI_INT, 0, MPI_COMM_WORLD);
+  PMPI_Gather(&wall_time_sec, 1, MPI_DOUBLE, walls.data(), 1, MPI_DOUBLE, 0, MPI_COMM_WORLD);
+  std::vector<int> displs(size);
+  for (int i = 1; i < size; i++) {
+    displs[i] = displs[i - 1] + lengths[i - 1];
+  }
+  std::vector<char> all(rank == 0 ? displs.back() + lengths.back() : 0);
+  PMPI_Gatherv(data.data(), length, MPI_CHAR, all.data(), lengths.data(), displs.data(), MPI_CHAR, 0, MPI_COMM_WORLD);
+  if (rank != 0 || all.empty()) {
+    return;
+  }
+
+  std::map<std::pair<std::string, std::string>, SiteSummary> sites;
+  std::vector<double> mpi_time(size);
+  for (int r = 0; r < size; r++) {
+    std::istringstream lines(std::string(all.data() + displs[r], lengths[r]));
+    std::string operation;
+    std::string caller;
+    CallStats stats;
+    while (std::getline(lines, operation, '\t') && std::getline(lines, caller, '\t') && lines >> stats.calls >>
+           stats.bytes >> stats.time_sec) {
+      lines.ignore();
+      auto &summary = sites[{operation, caller}];
+      summary.calls += stats.calls;
+      summary.bytes += stats.bytes;
+      summary.time_sum += stats.time_sec;
+      summary.time_max = std::max(summary.time_max, stats.time_sec);
+      mpi_time[r] += stats.time_sec;
+    }
+  }
+
+  std::vector<std::pair<std::pair<std::string, std::string>, SiteSummary>> rows(sites.begin(), sites.end());
+  std::ranges::sort(rows, [](const auto &a, const auto &b) { return a.second.time_max > b.second.time_max; });
+
+  std::ostringstream report;
+  report << std::fixed << std::setprecision(1) << "[ MPI PROFILE ] " << title << ": " << size
+         << " processes, time in MPI per process:";
+  for (int r = 0; r < size; r++) {
+    report << ' ' << r << '=' << (walls[r] > 0.0 ? 100.0 * mpi_time[r] / walls[r] : 0.0) << '%';
+  }
+  report << '\n'
+         << "  " << std::left << std::setw(16) << "operation" << std::right << std::setw(10) << "calls"
+         << std::setw(12) << "bytes" << std::setw(14) << "mean_sec" << std::setw(14) << "max_sec" << "  call site\n"
+         << std::setprecision(6);
+  constexpr std::size_t kMaxRows = 15;
+  for (std::size_t i = 0; i < std::min(rows.size(), kMaxRows); i++) {
+    const auto &[site, summary] = rows[i];
+    report << "  " << std::left << std::setw(16) << site.first << std::right << std::setw(10) << summary.calls
+           << std::setw(12) << FormatBytes(summary.bytes) << std::setw(14) << summary.time_sum / size
+           << std::setw(14) << summary.time_max << "  " << site.second << '\n';
+  }
+  if (rows.size() > kMaxRows) {
+    report << "  ... " << rows.size() - kMaxRows << " more call sites\n";
+  }
+  if (!CaptureCallers()) {
+    report << "  (set PPC_MPI_PROFILE_CALLERS=1 to split the calls by call site)\n";
+  }
+  out << report.str() << std::flush;
+}
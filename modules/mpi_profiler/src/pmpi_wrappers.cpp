@@ -0,0 +1,180 @@
+#include <mpi.h>
+
+#include <cstdint>
+
+#include "mpi_profiler/include/mpi_profiler.hpp"
+
+using ppc::mpi_profiler::detail::ScopedCall;
+
+namespace {
+
+std::uint64_t Bytes(int count, MPI_Datatype type) {
+  if (count <= 0) {
+    return 0;
+  }
+  int size = 0;
+  PMPI_Type_size(type, &size);
+  return static_cast<std::uint64_t>(count) * static_cast<std::uint64_t>(size);
+}
+
+std::uint64_t Bytes(const int counts[], int n, MPI_Datatype type) {
+  std::uint64_t total = 0;
+  for (int i = 0; i < n; i++) {
+    total += Bytes(counts[i], type);
+  }
+  return total;
+}
+
+int Rank(MPI_Comm comm) {
+  int rank = 0;
+  PMPI_Comm_rank(comm, &rank);
+  return rank;
+}
+
+int Size(MPI_Comm comm) {
+  int size = 1;
+  PMPI_Comm_size(comm, &size);
+  return size;
+}
+
+// Arguments that are significant only at the root are not touched on other processes
+std::uint64_t RootedBytes(const void *local_buf, int local_count, MPI_Datatype local_type, int root_count,
+                          MPI_Datatype root_type, int root, MPI_Comm comm) {
+  std::uint64_t bytes = local_buf == MPI_IN_PLACE ? 0 : Bytes(local_count, local_type);
+  if (Rank(comm) == root) {
+    bytes += Bytes(root_count, root_type) * static_cast<std::uint64_t>(Size(comm));
+  }
+  return bytes;
+}
+
+std::uint64_t RootedBytes(const void *local_buf, int local_count, MPI_Datatype local_type, const int root_counts[],
+                          MPI_Datatype root_type, int root, MPI_Comm comm) {
+  std::uint64_t bytes = local_buf == MPI_IN_PLACE ? 0 : Bytes(local_count, local_type);
+  if (Rank(comm) == root) {
+    bytes += Bytes(root_counts, Size(comm), root_type);
+  }
+  return bytes;
+}
+
+}  // namespace
+
+// Bytes are the volume sent plus received by the calling process, as given by the call arguments
+
+// NOLINTBEGIN(readability-identifier-naming)
+extern "C" {
+
+int MPI_Send(const void *buf, int count, MPI_Datatype datatype, int dest, int tag, MPI_Comm comm) {
+  ScopedCall call("MPI_Send", Bytes(count, datatype));
+  return PMPI_Send(buf, count, datatype, dest, tag, comm);
+}
+
+int MPI_Recv(void *buf, int count, MPI_Datatype datatype, int source, int tag, MPI_Comm comm, MPI_Status *status) {
+  ScopedCall call("MPI_Recv", Bytes(count, datatype));
+  return PMPI_Recv(buf, count, datatype, source, tag, comm, status);
+}
+
+int MPI_Isend(const void *buf, int count, MPI_Datatype datatype, int dest, int tag, MPI_Comm comm,
+              MPI_Request *request) {
+  ScopedCall call("MPI_Isend", Bytes(count, datatype));
+  return PMPI_Isend(buf, count, datatype, dest, tag, comm, request);
+}
+
+int MPI_Irecv(void *buf, int count, MPI_Datatype datatype, int source, int tag, MPI_Comm comm, MPI_Request *request) {
+  ScopedCall call("MPI_Irecv", Bytes(count, datatype));
+  return PMPI_Irecv(buf, count, datatype, source, tag, comm, request);
+}
+
+int MPI_Wait(MPI_Request *request, MPI_Status *status) {
+  ScopedCall call("MPI_Wait", 0);
+  return PMPI_Wait(request, status);
+}
+
+int MPI_Waitall(int count, MPI_Request array_of_requests[], MPI_Status *array_of_statuses) {
+  ScopedCall call("MPI_Waitall", 0);
+  return PMPI_Waitall(count, array_of_requests, array_of_statuses);
+}
+
+int MPI_Sendrecv(const void *sendbuf, int sendcount, MPI_Datatype sendtype, int dest, int sendtag, void *recvbuf,
+                 int recvcount, MPI_Datatype recvtype, int source, int recvtag, MPI_Comm comm, MPI_Status *status) {
+  ScopedCall call("MPI_Sendrecv", Bytes(sendcount, sendtype) + Bytes(recvcount, recvtype));
+  return PMPI_Sendrecv(sendbuf, sendcount, sendtype, dest, sendtag, recvbuf, recvcount, recvtype, source, recvtag,
+                       comm, status);
+}
+
+int MPI_Probe(int source, int tag, MPI_Comm comm, MPI_Status *status) {
+  ScopedCall call("MPI_Probe", 0);
+  return PMPI_Probe(source, tag, comm, status);
+}
+
+int MPI_Barrier(MPI_Comm comm) {
+  ScopedCall call("MPI_Barrier", 0);
+  return PMPI_Barrier(comm);
+}
+
+int MPI_Bcast(void *buffer, int count, MPI_Datatype datatype, int root, MPI_Comm comm) {
+  ScopedCall call("MPI_Bcast", Bytes(count, datatype));
+  return PMPI_Bcast(buffer, count, datatype, root, comm);
+}
+
+int MPI_Reduce(const void *sendbuf, void *recvbuf, int count, MPI_Datatype datatype, MPI_Op op, int root,
+               MPI_Comm comm) {
+  ScopedCall call("MPI_Reduce", Bytes(count, datatype));
+  return PMPI_Reduce(sendbuf, recvbuf, count, datatype, op, root, comm);
+}
+
+int MPI_Allreduce(const void *sendbuf, void *recvbuf, int count, MPI_Datatype datatype, MPI_Op op, MPI_Comm comm) {
+  ScopedCall call("MPI_Allreduce", Bytes(count, datatype));
+  return PMPI_Allreduce(sendbuf, recvbuf, count, datatype, op, comm);
+}
+
+int MPI_Scatter(const void *sendbuf, int sendcount, MPI_Datatype sendtype, void *recvbuf, int recvcount,
+                MPI_Datatype recvtype, int root, MPI_Comm comm) {
+  ScopedCall call("MPI_Scatter", RootedBytes(recvbuf, recvcount, recvtype, sendcount, sendtype, root, comm));
+  return PMPI_Scatter(sendbuf, sendcount, sendtype, recvbuf, recvcount, recvtype, root, comm);
+}
+
+int MPI_Scatterv(const void *sendbuf, const int sendcounts[], const int displs[], MPI_Datatype sendtype,
+                 void *recvbuf, int recvcount, MPI_Datatype recvtype, int root, MPI_Comm comm) {
+  ScopedCall call("MPI_Scatterv", RootedBytes(recvbuf, recvcount, recvtype, sendcounts, sendtype, root, comm));
+  return PMPI_Scatterv(sendbuf, sendcounts, displs, sendtype, recvbuf, recvcount, recvtype, root, comm);
+}
+
+int MPI_Gather(const void *sendbuf, int sendcount, MPI_Datatype sendtype, void *recvbuf, int recvcount,
+               MPI_Datatype recvtype, int root, MPI_Comm comm) {
+  ScopedCall call("MPI_Gather", RootedBytes(sendbuf, sendcount, sendtype, recvcount, recvtype, root, comm));
+  return PMPI_Gather(sendbuf, sendcount, sendtype, recvbuf, recvcount, recvtype, root, comm);
+}
+
+int MPI_Gatherv(const void *sendbuf, int sendcount, MPI_Datatype sendtype, void *recvbuf, const int recvcounts[],
+                const int displs[], MPI_Datatype recvtype, int root, MPI_Comm comm) {
+  ScopedCall call("MPI_Gatherv", RootedBytes(sendbuf, sendcount, sendtype, recvcounts, recvtype, root, comm));
+  return PMPI_Gatherv(sendbuf, sendcount, sendtype, recvbuf, recvcounts, displs, recvtype, root, comm);
+}
+
+int MPI_Allgather(const void *sendbuf, int sendcount, MPI_Datatype sendtype, void *recvbuf, int recvcount,
+                  MPI_Datatype recvtype, MPI_Comm comm) {
+  const auto bytes = (sendbuf == MPI_IN_PLACE ? 0 : Bytes(sendcount, sendtype)) +
+                     Bytes(recvcount, recvtype) * static_cast<std::uint64_t>(Size(comm));
+  ScopedCall call("MPI_Allgather", bytes);
+  return PMPI_Allgather(sendbuf, sendcount, sendtype, recvbuf, recvcount, recvtype, comm);
+}
+
+int MPI_Allgatherv(const void *sendbuf, int sendcount, MPI_Datatype sendtype, void *recvbuf, const int recvcounts[],
+                   const int displs[], MPI_Datatype recvtype, MPI_Comm comm) {
+  const auto bytes =
+      (sendbuf == MPI_IN_PLACE ? 0 : Bytes(sendcount, sendtype)) + Bytes(recvcounts, Size(comm), recvtype);
+  ScopedCall call("MPI_Allgatherv", bytes);
+  return PMPI_Allgatherv(sendbuf, sendcount, sendtype, recvbuf, recvcounts, displs, recvtype, comm);
+}
+
+int MPI_Alltoall(const void *sendbuf, int sendcount, MPI_Datatype sendtype, void *recvbuf, int recvcount,
+                 MPI_Datatype recvtype, MPI_Comm comm) {
+  const auto size = static_cast<std::uint64_t>(Size(comm));
+  const auto bytes =
+      ((sendbuf == MPI_IN_PLACE ? 0 : Bytes(sendcount, sendtype)) + Bytes(recvcount, recvtype)) * size;
+  ScopedCall call("MPI_Alltoall", bytes);
+  return PMPI_Alltoall(sendbuf, sendcount, sendtype, recvbuf, recvcount, recvtype, comm);
+}
+
+}  // extern "C"
+// NOLINTEND(readability-identifier-naming)
@@ -0,0 +1,43 @@
+#include <gtest/gtest.h>
+#include <mpi.h>
+
+#include <chrono>
+#include <iostream>
+#include <string>
+
+#include "mpi_profiler/include/mpi_profiler.hpp"
+
+namespace {
+
+// Prints the MPI breakdown of every test right after it, next to the output of ppc::core::Perf
+class ProfileListener : public ::testing::EmptyTestEventListener {
+ public:
+  void OnTestStart(const ::testing::TestInfo& /*test_info*/) override {
+    ppc::mpi_profiler::Reset();
+    start_ = std::chrono::steady_clock::now();
+  }
+
+  void OnTestEnd(const ::testing::TestInfo& test_info) override {
+    int initialized = 0;
+    int finalized = 0;
+    PMPI_Initialized(&initialized);
+    PMPI_Finalized(&finalized);
+    if (initialized == 0 || finalized != 0) {
+      return;
+    }
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start_;
+    ppc::mpi_profiler::PrintSummary(std::cout, std::string(test_info.test_suite_name()) + "." + test_info.name(),
+                                    elapsed.count());
+  }
+
+ private:
+  std::chrono::steady_clock::time_point start_;
+};
+
+// Linking the profiler is the only step needed to enable it
+[[maybe_unused]] const bool kListenerRegistered = [] {
+  ::testing::UnitTest::GetInstance()->listeners().Append(new ProfileListener);
+  return true;
+}();
+
+}  // namespace
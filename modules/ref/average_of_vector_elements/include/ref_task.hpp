@@ -3,7 +3,7 @@
 
 #include <memory>
 #include <numeric>
-#include <vector>
+#include <span>
 
 #include "core/task/include/task.hpp"
 
@@ -14,12 +14,8 @@ class AverageOfVectorElements : public ppc::core::Task {
  public:
   explicit AverageOfVectorElements(ppc::core::TaskDataPtr task_data) : Task(task_data) {}
   bool PreProcessingImpl() override {
-    // Init vectors
-    input_ = std::vector<InType>(task_data->inputs_count[0]);
-    auto tmp_ptr = reinterpret_cast<InType*>(task_data->inputs[0]);
-    for (unsigned i = 0; i < task_data->inputs_count[0]; i++) {
-      input_[i] = tmp_ptr[i];
-    }
+    // Init view of input vector
+    input_ = task_data->GetInput<InType>(0);
     // Init value for output
     average_ = 0.0;
     return true;
@@ -42,7 +38,7 @@ class AverageOfVectorElements : public ppc::core::Task {
   }
 
  private:
-  std::vector<InType> input_;
+  std::span<const InType> input_;
   OutType average_;
 };
 
@@ -3,6 +3,7 @@
 
 #include <algorithm>
 #include <memory>
+#include <span>
 #include <vector>
 
 #include "core/task/include/task.hpp"
@@ -14,12 +15,8 @@ class MostDifferentNeighborElements : public ppc::core::Task {
  public:
   explicit MostDifferentNeighborElements(ppc::core::TaskDataPtr task_data) : Task(task_data) {}
   bool PreProcessingImpl() override {
-    // Init vectors
-    input_ = std::vector<InOutType>(task_data->inputs_count[0]);
-    auto tmp_ptr = reinterpret_cast<InOutType*>(task_data->inputs[0]);
-    for (unsigned i = 0; i < task_data->inputs_count[0]; i++) {
-      input_[i] = tmp_ptr[i];
-    }
+    // Init view of input vector
+    input_ = task_data->GetInput<InOutType>(0);
     // Init value for output
     l_elem_ = r_elem_ = 0;
     l_elem_index_ = r_elem_index_ = 0;
@@ -32,7 +29,7 @@ class MostDifferentNeighborElements : public ppc::core::Task {
   }
 
   bool RunImpl() override {
-    auto rotate_in = input_;
+    auto rotate_in = std::vector<InOutType>(input_.begin(), input_.end());
     int rot_left = 1;
     rotate(rotate_in.begin(), rotate_in.begin() + rot_left, rotate_in.end());
 
@@ -58,7 +55,7 @@ class MostDifferentNeighborElements : public ppc::core::Task {
   }
 
  private:
-  std::vector<InOutType> input_;
+  std::span<const InOutType> input_;
   InOutType l_elem_, r_elem_;
   IndexType l_elem_index_, r_elem_index_;
 };
@@ -3,6 +3,7 @@
 
 #include <algorithm>
 #include <memory>
+#include <span>
 #include <vector>
 
 #include "core/task/include/task.hpp"
@@ -14,12 +15,8 @@ class NumOfOrderlyViolations : public ppc::core::Task {
  public:
   explicit NumOfOrderlyViolations(ppc::core::TaskDataPtr task_data) : Task(task_data) {}
   bool PreProcessingImpl() override {
-    // Init vectors
-    input_ = std::vector<InOutType>(task_data->inputs_count[0]);
-    auto tmp_ptr = reinterpret_cast<InOutType*>(task_data->inputs[0]);
-    for (unsigned i = 0; i < task_data->inputs_count[0]; i++) {
-      input_[i] = tmp_ptr[i];
-    }
+    // Init view of input vector
+    input_ = task_data->GetInput<InOutType>(0);
     // Init value for output
     num_ = 0;
     return true;
@@ -31,7 +28,7 @@ class NumOfOrderlyViolations : public ppc::core::Task {
   }
 
   bool RunImpl() override {
-    auto rotate_in = input_;
+    auto rotate_in = std::vector<InOutType>(input_.begin(), input_.end());
     int rot_left = 1;
     rotate(rotate_in.begin(), rotate_in.begin() + rot_left, rotate_in.end());
 
@@ -49,7 +46,7 @@ class NumOfOrderlyViolations : public ppc::core::Task {
   }
 
  private:
-  std::vector<InOutType> input_;
+  std::span<const InOutType> input_;
   CountType num_;
 };
 
@@ -4,6 +4,7 @@
 #include <cstddef>
 #include <memory>
 #include <numeric>
+#include <span>
 #include <vector>
 
 #include "core/task/include/task.hpp"
@@ -15,12 +16,8 @@ class SumValuesByRowsMatrix : public ppc::core::Task {
  public:
   explicit SumValuesByRowsMatrix(ppc::core::TaskDataPtr task_data) : Task(task_data) {}
   bool PreProcessingImpl() override {
-    // Init vectors
-    input_ = std::vector<InOutType>(task_data->inputs_count[0]);
-    auto tmp_ptr = reinterpret_cast<InOutType*>(task_data->inputs[0]);
-    for (unsigned i = 0; i < task_data->inputs_count[0]; i++) {
-      input_[i] = tmp_ptr[i];
-    }
+    // Init view of input vector
+    input_ = task_data->GetInput<InOutType>(0);
     rows_ = reinterpret_cast<IndexType*>(task_data->inputs[1])[0];
     cols_ = reinterpret_cast<IndexType*>(task_data->inputs[1])[1];
 
@@ -50,7 +47,7 @@ class SumValuesByRowsMatrix : public ppc::core::Task {
   }
 
  private:
-  std::vector<InOutType> input_;
+  std::span<const InOutType> input_;
   IndexType rows_, cols_;
   std::vector<InOutType> sum_;
 };
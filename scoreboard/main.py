@@ -1,10 +1,19 @@
 from pathlib import Path
 from collections import defaultdict
 import argparse
+import json
 import yaml
 
 task_types = ['all', 'mpi', 'omp', 'seq', 'stl', 'tbb']
 
+parser = argparse.ArgumentParser(description='Generate HTML scoreboard.')
+parser.add_argument('-o', '--output', type=str, required=True, help='Output file path')
+parser.add_argument('-p', '--perf-results', type=str, nargs='*',
+                    default=[str(Path('build') / 'perf_stat_dir' / 'perf_results.jsonl')],
+                    help='Perf records (JSON lines written through PPC_PERF_OUTPUT) or directories of them, '
+                         'runs with several process/thread counts give the scaling columns')
+args = parser.parse_args()
+
 tasks_dir = Path('tasks')
 
 directories = defaultdict(dict)
@@ -29,6 +38,112 @@ with open(plagiarism_config_path, 'r') as file:
     plagiarism_cfg = yaml.safe_load(file)
 assert plagiarism_cfg, "Plagiarism configuration is empty"
 
+
+def load_perf_results(paths):
+    """Median times {task: {type: {(type_of_running, test, input_size): {workers: seconds}}}}.
+
+    Sweep points are named "test[size=...,threads=...]", their sequential baselines "test[size=...,baseline]";
+    the baselines are filed as seq runs of the test."""
+    files = []
+    for path in map(Path, paths):
+        if path.is_dir():
+            files += sorted(path.glob('*.jsonl'))
+        elif path.is_file():
+            files.append(path)
+    samples = defaultdict(lambda: defaultdict(lambda: defaultdict(lambda: defaultdict(list))))
+    for file_path in files:
+        with open(file_path, 'r') as file:
+            for line in file:
+                if not line.strip():
+                    continue
+                record = json.loads(line)
+                task_type, processes, threads = record['technology'], record['processes'], record['threads']
+                test = record.get('test', '')
+                if test.endswith(',baseline]'):
+                    task_type = 'seq'
+                test = test.split('[')[0]
+                # workers of the run: processes for mpi, threads for omp/tbb/stl, both for all
+                workers = {'seq': 1, 'mpi': processes, 'all': processes * threads}.get(task_type, threads)
+                median = record.get('stats', {}).get('median')
+                if median is None:
+                    median = record['time_sec']
+                series = (record['type_of_running'], test, record.get('input_size', 0))
+                samples[record['task']][task_type][series][workers].append(median)
+    results = defaultdict(dict)
+    for task_name, types in samples.items():
+        for task_type, series in types.items():
+            results[task_name][task_type] = {
+                key: {workers: sorted(times)[len(times) // 2] for workers, times in by_workers.items()}
+                for key, by_workers in series.items()}
+    return results
+
+
+def reference_time(task_results, series, times):
+    """Time the speedup is measured against: the seq run of the same problem (same type of running and input size,
+    the same test preferred) or else 1 worker of the series itself. Runs of other sizes are never compared."""
+    run, test, size = series
+    candidates = [(seq_test != test, seq_times[1]) for (seq_run, seq_test, seq_size), seq_times in
+                  task_results.get('seq', {}).items() if seq_run == run and seq_size == size and 1 in seq_times]
+    if candidates:
+        return min(candidates)[1], 'seq'
+    if 1 in times:
+        return times[1], '1 worker'
+    return None, None
+
+
+def scaling_series(task_results, task_type):
+    """Speedup, efficiency and Karp-Flatt serial fraction for every series and measured count of workers."""
+    if task_type == 'seq':
+        return []
+    result = []
+    for series, times in sorted(task_results.get(task_type, {}).items()):
+        reference, reference_kind = reference_time(task_results, series, times)
+        metrics = []
+        for workers in sorted(times):
+            metric = {'workers': workers, 'time': times[workers], 'speedup': None, 'efficiency': None,
+                      'karp_flatt': None}
+            if reference and times[workers] > 0:
+                metric['speedup'] = reference / times[workers]
+                metric['efficiency'] = metric['speedup'] / workers
+                if workers > 1:
+                    metric['karp_flatt'] = (1 / metric['speedup'] - 1 / workers) / (1 - 1 / workers)
+            metrics.append(metric)
+        result.append({'run': series[0], 'test': series[1], 'size': series[2], 'reference': reference_kind,
+                       'metrics': metrics})
+    return result
+
+
+def scaling_cells(series_list):
+    """A and E cells of the most representative series (task_run, seq reference, largest size), at its largest
+    count of workers; super-linear or anti-scaling runs are highlighted."""
+    # series whose times are all zero (or measured against a zero reference) have no speedup to show
+    measured = [series for series in series_list if series['reference'] is not None
+                and any(m['speedup'] is not None for m in series['metrics'])]
+    if not measured:
+        if series_list:
+            title = 'no seq run or 1 worker run at the same input size'
+            return f'<td style="text-align: center;" title="{title}">-</td>' * 2
+        return '<td style="text-align: center;">0</td>' * 2
+    series = max(measured, key=lambda item: (item['run'] == 'task_run', item['reference'] == 'seq', item['size'],
+                                             len(item['metrics'])))
+    metrics = [m for m in series['metrics'] if m['speedup'] is not None]
+    top = metrics[-1]
+    speedups = [m['speedup'] for m in metrics]
+    style = 'text-align: center;'
+    if top['efficiency'] > 1.0:
+        style += ' background-color: lightgreen;'
+    elif top['speedup'] < 1.0 or any(b < a for a, b in zip(speedups, speedups[1:])):
+        style += ' background-color: orange;'
+    details = f"{series['test']} ({series['run']}), size {series['size']}, vs {series['reference']}&#10;"
+    details += '&#10;'.join(
+        f"{m['workers']}: T={m['time']:.4g}s S={m['speedup']:.2f} E={m['efficiency']:.0%}"
+        + (f" e={m['karp_flatt']:.3f}" if m['karp_flatt'] is not None else '') for m in metrics)
+    return (f'<td style="{style}" title="{details}">{top["speedup"]:.2f}</td>'
+            f'<td style="{style}" title="{details}">{top["efficiency"]:.0%}</td>')
+
+
+perf_results = load_perf_results(args.perf_results)
+
 columns = ''.join(['<th colspan=5 style="text-align: center;">' + task_type + '</th>' for task_type in task_types])
 html_content = f"""
 <!DOCTYPE html>
@@ -46,6 +161,11 @@ html_content = f"""
         Speedup = T(seq) / T(parallel)<br/>
         <b>(E)fficiency</b> - Optimizing software speed-up by improving CPU utilization and resource management.
         Efficiency = Speedup / NumProcs * 100%<br/>
+        Both are shown for the largest measured count of processes (mpi), threads (omp, tbb, stl) or
+        processes &times; threads (all); the other counts and the Karp&ndash;Flatt serial fraction
+        e = (1/S - 1/p) / (1 - 1/p) are listed under the table.
+        <span style="background-color: lightgreen;">Super-linear</span> and
+        <span style="background-color: orange;">anti-scaling</span> results are highlighted.<br/>
         <b>(D)eadline</b> - The timeliness of the submission in relation to the given deadline.<br/>
         <b>(P)lagiarism</b> - The originality of the work, ensuring no copied content from external sources.<br/>
     </p>
@@ -78,8 +198,7 @@ for dir in sorted(directories.keys()):
             task_count += max_sol_points
         else:
             html_content += '<td style="text-align: center;">0</td>'
-        html_content += '<td style="text-align: center;">0</td>'
-        html_content += '<td style="text-align: center;">0</td>'
+        html_content += scaling_cells(scaling_series(perf_results.get(dir, {}), task_type))
         html_content += '<td style="text-align: center;">0</td>'
         is_cheated = \
             dir in plagiarism_cfg["plagiarism"][task_type] or \
@@ -97,14 +216,41 @@ for dir in sorted(directories.keys()):
 
 html_content += """
     </table>
+"""
+
+scaling_rows = ''
+for dir in sorted(perf_results.keys()):
+    for task_type in task_types:
+        for series in scaling_series(perf_results[dir], task_type):
+            for m in series['metrics']:
+                if m['speedup'] is None:
+                    values = '<td colspan=3>no seq run or 1 worker run at this size</td>'
+                else:
+                    karp_flatt = f"{m['karp_flatt']:.3f}" if m['karp_flatt'] is not None else '-'
+                    values = (f"<td>{m['speedup']:.2f}{' *' if series['reference'] == '1 worker' else ''}</td>"
+                              f"<td>{m['efficiency']:.0%}</td><td>{karp_flatt}</td>")
+                scaling_rows += (f"<tr><td>{dir}</td><td>{task_type}</td><td>{series['test']}</td>"
+                                 f"<td>{series['run']}</td><td>{series['size']}</td><td>{m['workers']}</td>"
+                                 f"<td>{m['time']:.4g}</td>{values}</tr>")
+if scaling_rows:
+    html_content += f"""
+    <h2>Scaling</h2>
+    <p>Median times in seconds. Speedups compare runs of the same input size only: against the seq run,
+    or (marked *) against 1 worker of the same technology when there is no seq run of that size.</p>
+    <table>
+        <tr>
+            <th>Task</th><th>Type</th><th>Test</th><th>Run</th><th>Size</th><th>p</th><th>T(p)</th><th>S(p)</th>
+            <th>E(p)</th><th>e (Karp&ndash;Flatt)</th>
+        </tr>
+        {scaling_rows}
+    </table>
+"""
+
+html_content += """
 </body>
 </html>
 """
 
-parser = argparse.ArgumentParser(description='Generate HTML scoreboard.')
-parser.add_argument('-o', '--output', type=str, required=True, help='Output file path')
-args = parser.parse_args()
-
 output_file = Path(args.output) / "index.html"
 with open(output_file, 'w') as file:
     file.write(html_content)
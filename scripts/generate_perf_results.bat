@@ -1,4 +1,7 @@
 @echo off
 mkdir build\perf_stat_dir
+set PPC_PERF_OUTPUT=%cd%\build\perf_stat_dir\perf_results.jsonl
+if exist %PPC_PERF_OUTPUT% del %PPC_PERF_OUTPUT%
 python3 scripts/run_tests.py --running-type="performance" > build\perf_stat_dir\perf_log.txt
-python scripts\create_perf_table.py --input build\perf_stat_dir\perf_log.txt --output build\perf_stat_dir
+python scripts\perf_history.py add --input %PPC_PERF_OUTPUT%
+python scripts\perf_history.py report --output build\perf_stat_dir\report
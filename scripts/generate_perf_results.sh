@@ -1,3 +1,6 @@
 mkdir -p build/perf_stat_dir
+export PPC_PERF_OUTPUT="$(pwd)/build/perf_stat_dir/perf_results.jsonl"
+rm -f "$PPC_PERF_OUTPUT"
 python3 scripts/run_tests.py --running-type="performance" | tee build/perf_stat_dir/perf_log.txt
-python3 scripts/create_perf_table.py --input build/perf_stat_dir/perf_log.txt --output build/perf_stat_dir
+python3 scripts/perf_history.py add --input "$PPC_PERF_OUTPUT"
+python3 scripts/perf_history.py report --output build/perf_stat_dir/report
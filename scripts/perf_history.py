@@ -0,0 +1,301 @@
+"""Append-only history of perf results and a trend/regression report.
+
+  python3 scripts/perf_history.py add --input build/perf_stat_dir/perf_results.jsonl
+  python3 scripts/perf_history.py report --output build/perf_stat_dir/report
+
+Records written by the perf tests (PPC_PERF_OUTPUT, JSON lines) are stored in an SQLite database keyed by commit,
+task, technology, test, type of running, input size and process/thread counts. The report compares every key of
+the latest commit with the previous commit that measured it (Mann-Whitney U test over the per-iteration samples)
+and draws scaling and history curves per task as SVG files. `report` exits with status 1 if it finds regressions.
+"""
+
+import argparse
+import datetime
+import json
+import math
+import sqlite3
+import subprocess
+import sys
+from pathlib import Path
+
+DEFAULT_DB = Path("build") / "perf_stat_dir" / "perf_history.sqlite"
+KEY_COLUMNS = ["task", "technology", "test", "type_of_running", "input_size", "processes", "threads"]
+
+SCHEMA = """
+CREATE TABLE IF NOT EXISTS commits (
+    id INTEGER PRIMARY KEY AUTOINCREMENT,
+    sha TEXT NOT NULL UNIQUE,
+    recorded_at TEXT NOT NULL
+);
+CREATE TABLE IF NOT EXISTS runs (
+    id INTEGER PRIMARY KEY AUTOINCREMENT,
+    commit_id INTEGER NOT NULL REFERENCES commits(id),
+    task TEXT NOT NULL,
+    technology TEXT NOT NULL,
+    test TEXT NOT NULL,
+    type_of_running TEXT NOT NULL,
+    input_size INTEGER NOT NULL,
+    processes INTEGER NOT NULL,
+    threads INTEGER NOT NULL,
+    time_sec REAL NOT NULL,
+    median_sec REAL,
+    samples TEXT NOT NULL,
+    build_type TEXT,
+    compiler TEXT,
+    record TEXT NOT NULL
+);
+CREATE INDEX IF NOT EXISTS runs_key ON runs (task, technology, test, type_of_running, input_size, processes,
+                                             threads, commit_id);
+"""
+
+
+def init_cmd_args():
+    parser = argparse.ArgumentParser(description="Perf results history and regression report")
+    parser.add_argument("--db", default=str(DEFAULT_DB), help=f"SQLite database (default {DEFAULT_DB})")
+    commands = parser.add_subparsers(dest="command", required=True)
+
+    add = commands.add_parser("add", help="Append the records of a perf run to the history")
+    add.add_argument("-i", "--input", required=True, help="JSON lines written through PPC_PERF_OUTPUT")
+    add.add_argument("--commit", help="Commit the records belong to (default: git HEAD)")
+
+    report = commands.add_parser("report", help="Compare the latest commit with the history")
+    report.add_argument("-o", "--output", required=True, help="Directory for report.md and the SVG plots")
+    report.add_argument("--commit", help="Commit to report on (default: the latest one added)")
+    report.add_argument("--alpha", type=float, default=0.01, help="Significance level of the test (default 0.01)")
+    report.add_argument("--min-change", type=float, default=0.05,
+                        help="Smallest relative change of the median reported (default 0.05)")
+    return parser.parse_args()
+
+
+def open_db(path):
+    Path(path).parent.mkdir(parents=True, exist_ok=True)
+    db = sqlite3.connect(path)
+    db.executescript(SCHEMA)
+    return db
+
+
+def current_commit():
+    try:
+        sha = subprocess.run(["git", "rev-parse", "HEAD"], stdout=subprocess.PIPE, stderr=subprocess.DEVNULL,
+                             text=True, check=True).stdout.strip()
+        dirty = subprocess.run(["git", "status", "--porcelain", "--untracked-files=no"], stdout=subprocess.PIPE,
+                               stderr=subprocess.DEVNULL, text=True, check=True).stdout.strip()
+        return sha + ("-dirty" if dirty else "")
+    except (OSError, subprocess.CalledProcessError):
+        return "unknown"
+
+
+def add_records(db, input_path, commit):
+    now = datetime.datetime.now(datetime.timezone.utc).isoformat(timespec="seconds")
+    db.execute("INSERT OR IGNORE INTO commits (sha, recorded_at) VALUES (?, ?)", (commit, now))
+    commit_id = db.execute("SELECT id FROM commits WHERE sha = ?", (commit,)).fetchone()[0]
+    count = 0
+    with open(input_path, "r") as file:
+        for line_number, line in enumerate(file, 1):
+            if not line.strip():
+                continue
+            try:
+                record = json.loads(line)
+            except json.JSONDecodeError as error:
+                raise Exception(f"{input_path}:{line_number}: not a JSON perf record ({error})")
+            stats = record.get("stats", {})
+            build = record.get("build", {})
+            db.execute(
+                "INSERT INTO runs (commit_id, task, technology, test, type_of_running, input_size, processes, "
+                "threads, time_sec, median_sec, samples, build_type, compiler, record) "
+                "VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?)",
+                (commit_id, record["task"], record["technology"], record.get("test", ""),
+                 record["type_of_running"], record.get("input_size", 0), record.get("processes", 1),
+                 record.get("threads", 1), record["time_sec"], stats.get("median"),
+                 json.dumps(record.get("samples") or [record["time_sec"]]), build.get("type", ""),
+                 build.get("compiler", ""), line.strip()))
+            count += 1
+    db.commit()
+    print(f"Added {count} records for commit {commit}")
+
+
+def median(values):
+    ordered = sorted(values)
+    middle = len(ordered) // 2
+    return ordered[middle] if len(ordered) % 2 else (ordered[middle - 1] + ordered[middle]) / 2
+
+
+def mann_whitney_p(before, after):
+    """Two-sided p-value of the Mann-Whitney U test (normal approximation with tie correction)."""
+    n1, n2 = len(before), len(after)
+    if n1 < 3 or n2 < 3:
+        return 1.0
+    values = sorted([(value, 0) for value in before] + [(value, 1) for value in after])
+    rank_sum = 0.0
+    tie_term = 0.0
+    i = 0
+    while i < len(values):
+        j = i
+        while j < len(values) and values[j][0] == values[i][0]:
+            j += 1
+        rank = (i + j + 1) / 2
+        rank_sum += rank * sum(1 for k in range(i, j) if values[k][1] == 0)
+        tie_term += (j - i) ** 3 - (j - i)
+        i = j
+    u = rank_sum - n1 * (n1 + 1) / 2
+    n = n1 + n2
+    variance = n1 * n2 / 12 * ((n + 1) - tie_term / (n * (n - 1)))
+    if variance <= 0:
+        return 1.0
+    z = (abs(u - n1 * n2 / 2) - 0.5) / math.sqrt(variance)
+    return math.erfc(max(z, 0.0) / math.sqrt(2))
+
+
+def load_samples(db, commit_id):
+    """Samples of every key measured at a commit, repeated runs are pooled."""
+    result = {}
+    rows = db.execute(f"SELECT {', '.join(KEY_COLUMNS)}, samples FROM runs WHERE commit_id = ?", (commit_id,))
+    for row in rows:
+        result.setdefault(tuple(row[:-1]), []).extend(json.loads(row[-1]))
+    return result
+
+
+def previous_samples(db, key, commit_id):
+    where = " AND ".join(f"{column} = ?" for column in KEY_COLUMNS)
+    row = db.execute(f"SELECT MAX(commit_id) FROM runs WHERE {where} AND commit_id < ?", (*key, commit_id)).fetchone()
+    if row[0] is None:
+        return None, None
+    samples = []
+    for (text,) in db.execute(f"SELECT samples FROM runs WHERE {where} AND commit_id = ?", (*key, row[0])):
+        samples.extend(json.loads(text))
+    sha = db.execute("SELECT sha FROM commits WHERE id = ?", (row[0],)).fetchone()[0]
+    return sha, samples
+
+
+def history(db, key):
+    where = " AND ".join(f"runs.{column} = ?" for column in KEY_COLUMNS)
+    points = {}
+    for commit_id, sha, text in db.execute(
+            f"SELECT commits.id, commits.sha, runs.samples FROM runs JOIN commits ON commits.id = runs.commit_id "
+            f"WHERE {where} ORDER BY commits.id", key):
+        points.setdefault((commit_id, sha), []).extend(json.loads(text))
+    return [(sha[:10], median(samples)) for (_, sha), samples in points.items()]
+
+
+def svg_chart(title, x_label, series, log_x=False):
+    """Line chart of {name: [(x, y), ...]}; x values may be strings (placed evenly)."""
+    width, height, left, right, top, bottom = 640, 360, 70, 160, 30, 50
+    labels = []
+    for points in series.values():
+        for x, _ in points:
+            if x not in labels:
+                labels.append(x)
+    numeric = all(isinstance(x, (int, float)) for x in labels)
+    if numeric:
+        labels.sort()
+
+    def x_pos(x):
+        if numeric and len(labels) > 1:
+            low, high, value = labels[0], labels[-1], x
+            if log_x and low > 0:
+                low, high, value = math.log2(low), math.log2(high), math.log2(x)
+            span = (high - low) or 1
+            return left + (value - low) / span * (width - left - right)
+        return left + (labels.index(x) + 0.5) / len(labels) * (width - left - right)
+
+    y_max = max((y for points in series.values() for _, y in points), default=1.0) * 1.1 or 1.0
+
+    def y_pos(y):
+        return height - bottom - y / y_max * (height - top - bottom)
+
+    colors = ["#1f77b4", "#ff7f0e", "#2ca02c", "#d62728", "#9467bd", "#8c564b", "#e377c2", "#7f7f7f"]
+    out = [f'<svg xmlns="http://www.w3.org/2000/svg" width="{width}" height="{height}" font-family="sans-serif" '
+           f'font-size="11">',
+           f'<text x="{width / 2}" y="18" text-anchor="middle" font-size="13">{title}</text>',
+           f'<line x1="{left}" y1="{height - bottom}" x2="{width - right}" y2="{height - bottom}" stroke="black"/>',
+           f'<line x1="{left}" y1="{top}" x2="{left}" y2="{height - bottom}" stroke="black"/>',
+           f'<text x="{(left + width - right) / 2}" y="{height - 8}" text-anchor="middle">{x_label}</text>',
+           f'<text x="14" y="{(top + height - bottom) / 2}" text-anchor="middle" '
+           f'transform="rotate(-90 14 {(top + height - bottom) / 2})">median time, s</text>']
+    for i in range(5):
+        y = y_max * i / 4
+        out.append(f'<text x="{left - 6}" y="{y_pos(y) + 4}" text-anchor="end">{y:.3g}</text>')
+    for x in labels:
+        out.append(f'<text x="{x_pos(x)}" y="{height - bottom + 16}" text-anchor="middle">{x}</text>')
+    for index, (name, points) in enumerate(sorted(series.items())):
+        color = colors[index % len(colors)]
+        coords = " ".join(f"{x_pos(x):.1f},{y_pos(y):.1f}" for x, y in sorted(points, key=lambda p: labels.index(p[0])))
+        out.append(f'<polyline points="{coords}" fill="none" stroke="{color}" stroke-width="2"/>')
+        for x, y in points:
+            out.append(f'<circle cx="{x_pos(x):.1f}" cy="{y_pos(y):.1f}" r="3" fill="{color}"/>')
+        out.append(f'<text x="{width - right + 10}" y="{top + 14 * index + 10}" fill="{color}">{name}</text>')
+    out.append("</svg>")
+    return "\n".join(out)
+
+
+def report(db, output, commit, alpha, min_change):
+    if commit is None:
+        row = db.execute("SELECT id, sha FROM commits ORDER BY id DESC LIMIT 1").fetchone()
+    else:
+        row = db.execute("SELECT id, sha FROM commits WHERE sha LIKE ? ORDER BY id DESC", (commit + "%",)).fetchone()
+    if row is None:
+        raise Exception("No perf results in the history" + (f" for commit {commit}" if commit else ""))
+    commit_id, sha = row
+    current = load_samples(db, commit_id)
+
+    output = Path(output)
+    (output / "plots").mkdir(parents=True, exist_ok=True)
+    lines = [f"# Perf report for {sha}", "",
+             f"Mann-Whitney U test of the samples against the previous commit that measured the same key, "
+             f"alpha = {alpha}, changes of the median below {min_change:.0%} are ignored.", "",
+             "| task | technology | test | run | size | procs | threads | before | median, s | change | p | verdict |",
+             "|---|---|---|---|---|---|---|---|---|---|---|---|"]
+    regressions = 0
+    for key in sorted(current):
+        samples = current[key]
+        before_sha, before = previous_samples(db, key, commit_id)
+        now = median(samples)
+        if not before:
+            change, p_value, verdict = "", "", "new"
+        else:
+            ratio = now / median(before) if median(before) > 0 else math.inf
+            p = mann_whitney_p(before, samples)
+            change, p_value = f"{ratio - 1:+.1%}", f"{p:.3g}"
+            verdict = "same"
+            if p < alpha and ratio > 1 + min_change:
+                verdict = "**regression**"
+                regressions += 1
+            elif p < alpha and ratio < 1 - min_change:
+                verdict = "improvement"
+        lines.append(f"| {' | '.join(str(value) for value in key)} | {before_sha[:10] if before_sha else ''} | "
+                     f"{now:.6g} | {change} | {p_value} | {verdict} |")
+
+    # scaling curves of the reported commit and history of every key of a task
+    tasks = sorted({(key[0], key[3]) for key in current})
+    lines += ["", "## Plots", ""]
+    for task, type_of_running in tasks:
+        keys = [key for key in current if key[0] == task and key[3] == type_of_running]
+        scaling = {}
+        for key in keys:
+            technology, processes, threads = key[1], key[5], key[6]
+            workers = processes * threads if technology == "all" else (processes if technology == "mpi" else threads)
+            scaling.setdefault(f"{technology} {key[2]}", []).append((workers, median(current[key])))
+        trend = {f"{key[1]} {key[2]} p{key[5]} t{key[6]}": history(db, key) for key in keys}
+        name = f"{task}_{type_of_running}"
+        (output / "plots" / f"{name}_scaling.svg").write_text(
+            svg_chart(f"{task} ({type_of_running}): scaling", "processes x threads", scaling, log_x=True))
+        (output / "plots" / f"{name}_history.svg").write_text(
+            svg_chart(f"{task} ({type_of_running}): history", "commit", trend))
+        lines += [f"### {task} ({type_of_running})", "",
+                  f"![scaling](plots/{name}_scaling.svg) ![history](plots/{name}_history.svg)", ""]
+
+    (output / "report.md").write_text("\n".join(lines) + "\n")
+    print(f"Report for {sha}: {len(current)} results, {regressions} regressions -> {output / 'report.md'}")
+    return regressions
+
+
+if __name__ == "__main__":
+    args = init_cmd_args()
+    database = open_db(args.db)
+    regressions = 0
+    if args.command == "add":
+        add_records(database, args.input, args.commit or current_commit())
+    else:
+        regressions = report(database, args.output, args.commit, args.alpha, args.min_change)
+    database.close()
+    sys.exit(1 if regressions else 0)
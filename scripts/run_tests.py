@@ -1,6 +1,7 @@
 import os
 import subprocess
 import platform
+import tempfile
 from pathlib import Path
 
 
@@ -19,6 +20,14 @@ def init_cmd_args():
         default="",
         help="Additional MPI arguments to pass to the mpirun command (optional)."
     )
+    parser.add_argument(
+        "--shards",
+        required=False,
+        type=int,
+        default=1,
+        help="Split MPI functional tests into this many concurrent mpirun jobs with gtest sharding; "
+             "0 picks as many as the available CPUs fit (optional)."
+    )
     args = parser.parse_args()
     _args_dict = vars(args)
     return _args_dict
@@ -83,6 +92,42 @@ class PPCRunner:
         if result.returncode != 0:
             raise Exception(f"Subprocess return {result.returncode}.")
 
+    @staticmethod
+    def __available_cpus():
+        if hasattr(os, "sched_getaffinity"):
+            return sorted(os.sched_getaffinity(0))
+        return list(range(os.cpu_count() or 1))
+
+    def __run_sharded(self, command, shards, proc_count):
+        # Every shard runs its part of the gtest suite (GTEST_SHARD_INDEX of GTEST_TOTAL_SHARDS) on its own CPUs,
+        # outputs are printed shard by shard once all of them finish
+        cpus = self.__available_cpus()
+        cpus_per_shard = len(cpus) // shards
+        bind = platform.system() == "Linux" and cpus_per_shard >= int(proc_count)
+        jobs = []
+        for index in range(shards):
+            env = dict(os.environ, GTEST_TOTAL_SHARDS=str(shards), GTEST_SHARD_INDEX=str(index))
+            shard_command = command
+            if bind:
+                cpu_set = ",".join(str(cpu) for cpu in cpus[index * cpus_per_shard:(index + 1) * cpus_per_shard])
+                shard_command = f"taskset -c {cpu_set} {command}"
+            log = tempfile.TemporaryFile(mode="w+")
+            process = subprocess.Popen(shard_command, shell=True, env=env, stdout=log, stderr=subprocess.STDOUT)
+            jobs.append((process, log))
+
+        failed = []
+        for index, (process, log) in enumerate(jobs):
+            return_code = process.wait()
+            log.seek(0)
+            print(f"[ SHARD {index + 1}/{shards} ] {command}", flush=True)
+            print(log.read(), flush=True)
+            log.close()
+            if return_code != 0:
+                failed.append(f"{index + 1} (return {return_code})")
+        print(f"[ SHARDS ] {shards - len(failed)} of {shards} passed: {command}", flush=True)
+        if failed:
+            raise Exception(f"Shards {', '.join(failed)} failed.")
+
     @staticmethod
     def __get_gtest_settings(repeats_count):
         command = "--gtest_also_run_disabled_tests "
@@ -112,18 +157,26 @@ class PPCRunner:
         self.__run_exec(f"{self.work_dir / 'core_func_tests'} {self.__get_gtest_settings(1)}")
         self.__run_exec(f"{self.work_dir / 'ref_func_tests'}  {self.__get_gtest_settings(1)}")
 
-    def run_processes(self, additional_mpi_args):
+    def run_processes(self, additional_mpi_args, shards=1):
         if os.environ.get("CLANG_BUILD") == "1":
             return
 
         proc_count = os.environ.get("PROC_COUNT")
         if proc_count is None:
             raise EnvironmentError("Required environment variable 'PROC_COUNT' is not set.")
+        if shards < 0:
+            raise ValueError("Count of shards can not be negative.")
+        if shards == 0:
+            shards = max(1, len(self.__available_cpus()) // int(proc_count))
 
         mpi_running = f"{self.mpi_exec} {additional_mpi_args} -np {proc_count}"
         if not os.environ.get("ASAN_RUN"):
-            self.__run_exec(f"{mpi_running} {self.work_dir / 'all_func_tests'} {self.__get_gtest_settings(10)}")
-            self.__run_exec(f"{mpi_running} {self.work_dir / 'mpi_func_tests'} {self.__get_gtest_settings(10)}")
+            for tests in ["all_func_tests", "mpi_func_tests"]:
+                command = f"{mpi_running} {self.work_dir / tests} {self.__get_gtest_settings(10)}"
+                if shards > 1:
+                    self.__run_sharded(command, shards, proc_count)
+                else:
+                    self.__run_exec(command)
 
     def run_performance(self):
         if not os.environ.get("ASAN_RUN"):
@@ -157,7 +210,7 @@ if __name__ == "__main__":
     if args_dict["running_type"] == "threads":
         ppc_runner.run_threads()
     elif args_dict["running_type"] == "processes":
-        ppc_runner.run_processes(args_dict["additional_mpi_args"])
+        ppc_runner.run_processes(args_dict["additional_mpi_args"], args_dict["shards"])
     elif args_dict["running_type"] == "performance":
         ppc_runner.run_performance()
     elif args_dict["running_type"] == "performance-list":
@@ -8,6 +8,7 @@
 
 #include "all/example/include/ops_all.hpp"
 #include "boost/mpi/communicator.hpp"
+#include "core/mpi/include/perf_mpi.hpp"
 #include "core/perf/include/perf.hpp"
 #include "core/task/include/task.hpp"
 
@@ -41,14 +42,14 @@ TEST(nesterov_a_test_task_all, test_pipeline_run) {
     auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(current_time_point - t0).count();
     return static_cast<double>(duration) * 1e-9;
   };
+  boost::mpi::communicator world;
+  ppc::core::mpi::SetMultiRankTiming(*perf_attr, world);
 
   // Create and init perf results
   auto perf_results = std::make_shared<ppc::core::PerfResults>();
 
   auto perf_analyzer = std::make_shared<ppc::core::Perf>(test_task_all);
   perf_analyzer->PipelineRun(perf_attr, perf_results);
-  // Create Perf analyzer
-  boost::mpi::communicator world;
   if (world.rank() == 0) {
     ppc::core::Perf::PrintPerfStatistic(perf_results);
   }
@@ -86,6 +87,8 @@ TEST(nesterov_a_test_task_all, test_task_run) {
     auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(current_time_point - t0).count();
     return static_cast<double>(duration) * 1e-9;
   };
+  boost::mpi::communicator world;
+  ppc::core::mpi::SetMultiRankTiming(*perf_attr, world);
 
   // Create and init perf results
   auto perf_results = std::make_shared<ppc::core::PerfResults>();
@@ -93,8 +96,6 @@ TEST(nesterov_a_test_task_all, test_task_run) {
   // Create Perf analyzer
   auto perf_analyzer = std::make_shared<ppc::core::Perf>(test_task_all);
   perf_analyzer->TaskRun(perf_attr, perf_results);
-  // Create Perf analyzer
-  boost::mpi::communicator world;
   if (world.rank() == 0) {
     ppc::core::Perf::PrintPerfStatistic(perf_results);
   }
@@ -0,0 +1,126 @@
+#include <gtest/gtest.h>
+
+#include <boost/mpi/communicator.hpp>
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "core/perf/include/perf.hpp"
+#include "core/perf/include/perf_record.hpp"
+#include "core/task/include/task.hpp"
+#include "core/task/include/thread_pool.hpp"
+#include "core/util/include/thread_config.hpp"
+#include "oneapi/tbb/blocked_range.h"
+#include "oneapi/tbb/parallel_for.h"
+#include "oneapi/tbb/task_arena.h"
+
+// Microbenchmark of the ways to run the rows of the example MatMul in parallel. Small matrices show the cost
+// of starting the parallel region, large ones the quality of the load balance. Every variant is measured by
+// ppc::core::Perf and reported as a perf record (see PPC_PERF_OUTPUT in perf_record.hpp).
+
+namespace {
+
+void MatMulRows(const std::vector<int> &in_vec, int rc_size, std::size_t row_begin, std::size_t row_end,
+                std::vector<int> &out_vec) {
+  for (int i = static_cast<int>(row_begin); i < static_cast<int>(row_end); ++i) {
+    for (int j = 0; j < rc_size; ++j) {
+      out_vec[(i * rc_size) + j] = 0;
+      for (int k = 0; k < rc_size; ++k) {
+        out_vec[(i * rc_size) + j] += in_vec[(i * rc_size) + k] * in_vec[(k * rc_size) + j];
+      }
+    }
+  }
+}
+
+// Runs one variant of the benchmark, so it is measured by ppc::core::Perf like any other task
+class VariantTask : public ppc::core::Task {
+ public:
+  explicit VariantTask(std::function<void()> run)
+      : Task(std::make_shared<ppc::core::TaskData>()), run_(std::move(run)) {}
+  bool ValidationImpl() override { return true; }
+  bool PreProcessingImpl() override { return true; }
+  bool RunImpl() override {
+    run_();
+    return true;
+  }
+  bool PostProcessingImpl() override { return true; }
+
+ private:
+  std::function<void()> run_;
+};
+
+}  // namespace
+
+TEST(nesterov_a_test_task_all, test_thread_pool_microbenchmark) {
+  const int num_threads = ppc::util::GetThreadConfig().num_threads;
+  auto &pool = ppc::core::ThreadPool::Shared();
+  oneapi::tbb::task_arena arena(num_threads);
+  boost::mpi::communicator world;
+
+  for (const int count : {16, 64, 256}) {
+    std::vector<int> in(count * count);
+    for (std::size_t i = 0; i < in.size(); i++) {
+      in[i] = static_cast<int>(i % 7) - 3;
+    }
+    std::vector<int> expected(in.size());
+    MatMulRows(in, count, 0, count, expected);
+    const int runs = count <= 64 ? 200 : 10;
+    const auto rows = static_cast<std::size_t>(count);
+
+    std::vector<std::pair<std::string, std::function<void(std::vector<int> &)>>> variants;
+    variants.emplace_back("std::thread", [&](std::vector<int> &out) {
+      std::vector<std::thread> threads;
+      for (int t = 0; t < num_threads; t++) {
+        threads.emplace_back(MatMulRows, std::cref(in), count, rows * t / num_threads, rows * (t + 1) / num_threads,
+                             std::ref(out));
+      }
+      for (auto &thread : threads) {
+        thread.join();
+      }
+    });
+    variants.emplace_back("openmp", [&](std::vector<int> &out) {
+#pragma omp parallel for schedule(static) num_threads(num_threads)
+      for (int i = 0; i < count; i++) {
+        MatMulRows(in, count, i, i + 1, out);
+      }
+    });
+    variants.emplace_back("tbb", [&](std::vector<int> &out) {
+      arena.execute([&] {
+        oneapi::tbb::parallel_for(oneapi::tbb::blocked_range<std::size_t>(0, rows),
+                                  [&](const auto &range) { MatMulRows(in, count, range.begin(), range.end(), out); });
+      });
+    });
+    variants.emplace_back("ppc::core::ThreadPool", [&](std::vector<int> &out) {
+      pool.ParallelFor(0, rows, [&](std::size_t begin, std::size_t end) { MatMulRows(in, count, begin, end, out); });
+    });
+
+    for (auto &[name, run] : variants) {
+      std::vector<int> out(in.size(), 0);
+      auto perf_attr = std::make_shared<ppc::core::PerfAttr>();
+      perf_attr->num_running = runs;
+      perf_attr->num_warmup = 1;
+      const auto t0 = std::chrono::steady_clock::now();
+      perf_attr->current_timer = [t0] {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+      };
+      auto perf_results = std::make_shared<ppc::core::PerfResults>();
+      ppc::core::Perf(std::make_shared<VariantTask>([&] { run(out); })).TaskRun(perf_attr, perf_results);
+      EXPECT_EQ(out, expected) << name;
+
+      // one record per matrix size and variant, named like the points of a scaling sweep
+      if (world.rank() == 0) {
+        const auto *test_info = ::testing::UnitTest::GetInstance()->current_test_info();
+        auto record = ppc::core::MakePerfRecord(*perf_results, test_info->file(),
+                                                std::string(test_info->name()) + "[matmul_" + std::to_string(count) +
+                                                    ",variant=" + name + "]");
+        record.threads = num_threads;
+        ppc::core::EmitPerfRecord(record);
+      }
+    }
+  }
+}
@@ -1,23 +1,24 @@
 #include "all/example/include/ops_all.hpp"
 
+#include <algorithm>
+#include <boost/mpi/collectives/all_reduce.hpp>
+#include <boost/mpi/inplace.hpp>
 #include <cmath>
 #include <cstddef>
 #include <functional>
-#include <thread>
 #include <vector>
 
-#include "core/util/include/util.hpp"
-#include "oneapi/tbb/task_arena.h"
-#include "oneapi/tbb/task_group.h"
+#include "core/mpi/include/hybrid_mpi.hpp"
+#include "core/task/include/partition.hpp"
+#include "oneapi/tbb/blocked_range.h"
+#include "oneapi/tbb/parallel_for.h"
 
 namespace {
-void MatMul(const std::vector<int> &in_vec, int rc_size, std::vector<int> &out_vec) {
-  for (int i = 0; i < rc_size; ++i) {
-    for (int j = 0; j < rc_size; ++j) {
-      out_vec[(i * rc_size) + j] = 0;
-      for (int k = 0; k < rc_size; ++k) {
-        out_vec[(i * rc_size) + j] += in_vec[(i * rc_size) + k] * in_vec[(k * rc_size) + j];
-      }
+void MatMulRow(const std::vector<int> &in_vec, int rc_size, int i, int *out_row) {
+  for (int j = 0; j < rc_size; ++j) {
+    out_row[j] = 0;
+    for (int k = 0; k < rc_size; ++k) {
+      out_row[j] += in_vec[(i * rc_size) + k] * in_vec[(k * rc_size) + j];
     }
   }
 }
@@ -25,14 +26,12 @@ void MatMul(const std::vector<int> &in_vec, int rc_size, std::vector<int> &out_v
 
 bool nesterov_a_test_task_all::TestTaskALL::PreProcessingImpl() {
   // Init value for input and output
-  unsigned int input_size = task_data->inputs_count[0];
-  auto *in_ptr = reinterpret_cast<int *>(task_data->inputs[0]);
-  input_ = std::vector<int>(in_ptr, in_ptr + input_size);
+  const auto input = task_data->GetInput<int>(0);
+  input_.assign(input.begin(), input.end());
 
-  unsigned int output_size = task_data->outputs_count[0];
-  output_ = std::vector<int>(output_size, 0);
+  output_.assign(task_data->GetOutput<int>(0).size(), 0);
 
-  rc_size_ = static_cast<int>(std::sqrt(input_size));
+  rc_size_ = static_cast<int>(std::sqrt(static_cast<double>(input.size())));
   return true;
 }
 
@@ -42,37 +41,28 @@ bool nesterov_a_test_task_all::TestTaskALL::ValidationImpl() {
 }
 
 bool nesterov_a_test_task_all::TestTaskALL::RunImpl() {
-  if (world_.rank() == 0) {
-#pragma omp parallel default(none)
-    {
-#pragma omp critical
-      { MatMul(input_, rc_size_, output_); }
+  // rows are split across the processes and then across the threads of the process-wide TBB arena; every process
+  // fills its rows of a zeroed matrix, so one all-reduce sums the disjoint parts into the result on all of them
+  auto &context = ppc::core::mpi::HybridContext::Get();
+  const auto world = context.Comm();
+  const auto partition = ppc::core::Partition::Rows(rc_size_, rc_size_, world.size());
+  const auto first_row = static_cast<int>(partition.FirstRow(world.rank()));
+  const auto last_row = first_row + static_cast<int>(partition.Rows(world.rank()));
+  output_.assign(partition.GlobalCount(), 0);
+  auto multiply_rows = [&](const oneapi::tbb::blocked_range<int> &rows) {
+    for (int i = rows.begin(); i < rows.end(); ++i) {
+      MatMulRow(input_, rc_size_, i, output_.data() + (static_cast<std::size_t>(i) * rc_size_));
     }
-  } else {
-    oneapi::tbb::task_arena arena(1);
-    arena.execute([&] {
-      tbb::task_group tg;
-      for (int i = 0; i < ppc::util::GetPPCNumThreads(); ++i) {
-        tg.run([&] { MatMul(input_, rc_size_, output_); });
-      }
-      tg.wait();
-    });
-  }
-
-  const int num_threads = ppc::util::GetPPCNumThreads();
-  std::vector<std::thread> threads(num_threads);
-  for (int i = 0; i < num_threads; i++) {
-    threads[i] = std::thread(MatMul, std::cref(input_), rc_size_, std::ref(output_));
-    threads[i].join();
-  }
+  };
+  context.Arena().execute(
+      [&] { oneapi::tbb::parallel_for(oneapi::tbb::blocked_range<int>(first_row, last_row), multiply_rows); });
 
-  world_.barrier();
+  boost::mpi::all_reduce(world, boost::mpi::inplace(output_.data()), static_cast<int>(output_.size()),
+                         std::plus<int>());
   return true;
 }
 
 bool nesterov_a_test_task_all::TestTaskALL::PostProcessingImpl() {
-  for (size_t i = 0; i < output_.size(); i++) {
-    reinterpret_cast<int *>(task_data->outputs[0])[i] = output_[i];
-  }
+  std::ranges::copy(output_, task_data->GetOutput<int>(0).begin());
   return true;
 }
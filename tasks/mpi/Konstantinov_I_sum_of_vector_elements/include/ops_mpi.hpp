@@ -6,6 +6,7 @@
 #include <utility>
 #include <vector>
 
+#include "core/mpi/include/comm_mpi.hpp"
 #include "core/task/include/task.hpp"
 
 namespace konstantinov_i_sum_of_vector_elements_mpi {
@@ -36,7 +37,7 @@ class SumVecElemParallel : public ppc::core::Task {
  private:
   std::vector<int> input_, output_;
   int result_{};
-  boost::mpi::communicator world_;
+  boost::mpi::communicator world_ = ppc::core::mpi::Comm();
 };
 
 }  // namespace konstantinov_i_sum_of_vector_elements_mpi
\ No newline at end of file
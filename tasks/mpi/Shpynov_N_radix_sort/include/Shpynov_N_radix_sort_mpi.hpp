@@ -9,6 +9,7 @@
 #include <utility>
 #include <vector>
 
+#include "core/mpi/include/comm_mpi.hpp"
 #include "core/task/include/task.hpp"
 
 namespace shpynov_n_radix_sort_mpi {
@@ -108,7 +109,7 @@ class TestTaskMPI : public ppc::core::Task {
  private:
   std::vector<int> input_;
   std::vector<int> result_;
-  boost::mpi::communicator world_;
+  boost::mpi::communicator world_ = ppc::core::mpi::Comm();
 };
 
 }  // namespace shpynov_n_radix_sort_mpi
\ No newline at end of file
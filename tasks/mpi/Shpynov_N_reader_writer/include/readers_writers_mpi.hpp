@@ -7,6 +7,7 @@
 #include <utility>
 #include <vector>
 
+#include "core/mpi/include/comm_mpi.hpp"
 #include "core/task/include/task.hpp"
 
 namespace shpynov_n_readers_writers_mpi {
@@ -45,6 +46,6 @@ class TestTaskMPI : public ppc::core::Task {
  private:
   std::vector<int> critical_resource_;
   std::vector<int> result_;
-  boost::mpi::communicator world_;
+  boost::mpi::communicator world_ = ppc::core::mpi::Comm();
 };
 }  // namespace shpynov_n_readers_writers_mpi
\ No newline at end of file
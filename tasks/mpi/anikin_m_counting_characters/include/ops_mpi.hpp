@@ -6,6 +6,7 @@
 #include <utility>
 #include <vector>
 
+#include "core/mpi/include/comm_mpi.hpp"
 #include "core/task/include/task.hpp"
 
 namespace anikin_m_counting_characters_mpi {
@@ -21,7 +22,7 @@ class TestTaskMPI : public ppc::core::Task {
  private:
   std::vector<char> input_1_, input_2_;
   int res_;
-  boost::mpi::communicator world_;
+  boost::mpi::communicator world_ = ppc::core::mpi::Comm();
 };
 
 }  // namespace anikin_m_counting_characters_mpi
\ No newline at end of file
@@ -6,6 +6,7 @@
 #include <utility>
 #include <vector>
 
+#include "core/mpi/include/comm_mpi.hpp"
 #include "core/task/include/task.hpp"
 
 namespace anikin_m_graham_scan_mpi {
@@ -34,7 +35,7 @@ class TestTaskMPI : public ppc::core::Task {
 
  private:
   std::vector<Pt> data_;
-  boost::mpi::communicator world_;
+  boost::mpi::communicator world_ = ppc::core::mpi::Comm();
 };
 
 }  // namespace anikin_m_graham_scan_mpi
\ No newline at end of file
@@ -6,6 +6,7 @@
 #include <utility>
 #include <vector>
 
+#include "core/mpi/include/comm_mpi.hpp"
 #include "core/task/include/task.hpp"
 
 namespace budazhapova_betcher_odd_even_merge_mpi {
@@ -33,6 +34,6 @@ class MergeParallel : public ppc::core::Task {
  private:
   std::vector<int> local_res_;
   std::vector<int> res_;
-  boost::mpi::communicator world_;
+  boost::mpi::communicator world_ = ppc::core::mpi::Comm();
 };
 }  // namespace budazhapova_betcher_odd_even_merge_mpi
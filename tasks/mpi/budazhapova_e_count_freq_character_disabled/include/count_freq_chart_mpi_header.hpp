@@ -5,6 +5,7 @@
 #include <string>
 #include <utility>
 
+#include "core/mpi/include/comm_mpi.hpp"
 #include "core/task/include/task.hpp"
 
 namespace budazhapova_e_count_freq_chart_mpi {
@@ -37,6 +38,6 @@ class TestMPITaskParallel : public ppc::core::Task {
   std::string input_, local_input_;
   int res_ = 0, local_res_{};
   char symb_;
-  boost::mpi::communicator world_;
+  boost::mpi::communicator world_ = ppc::core::mpi::Comm();
 };
 }  // namespace budazhapova_e_count_freq_chart_mpi
\ No newline at end of file
@@ -7,6 +7,7 @@
 #include <utility>
 #include <vector>
 
+#include "core/mpi/include/comm_mpi.hpp"
 #include "core/task/include/task.hpp"
 
 namespace chastov_v_algorithm_cannon_mpi {
@@ -23,7 +24,7 @@ class TestTaskMPI : public ppc::core::Task {
   size_t matrix_size_{}, total_elements_{};
   std::vector<double> first_matrix_, second_matrix_, result_matrix_;
   std::vector<double> block_1_, block_2_, local_c_;
-  boost::mpi::communicator world_;
+  boost::mpi::communicator world_ = ppc::core::mpi::Comm();
 
   bool PrepareComputation(boost::mpi::communicator& sub_world, int& submatrix_size, int& block_size);
   bool InitializeBlocks(boost::mpi::communicator& sub_world, int submatrix_size, int block_size);
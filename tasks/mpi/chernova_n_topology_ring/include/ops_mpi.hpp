@@ -5,6 +5,7 @@
 #include <utility>
 #include <vector>
 
+#include "core/mpi/include/comm_mpi.hpp"
 #include "core/task/include/task.hpp"
 
 namespace chernova_n_topology_ring_mpi {
@@ -22,7 +23,7 @@ class TestMPITaskParallel : public ppc::core::Task {
   std::vector<int> process_;
   std::vector<char> output_;
   int vector_size_{};
-  boost::mpi::communicator world_;
+  boost::mpi::communicator world_ = ppc::core::mpi::Comm();
 };
 
 }  // namespace chernova_n_topology_ring_mpi
@@ -5,6 +5,7 @@
 #include <utility>
 #include <vector>
 
+#include "core/mpi/include/comm_mpi.hpp"
 #include "core/task/include/task.hpp"
 
 namespace chernova_n_word_count_mpi {
@@ -39,7 +40,7 @@ class TestMPITaskParallel : public ppc::core::Task {
   int space_count_{};
   int local_space_count_{};
   int part_size_{};
-  boost::mpi::communicator world_;
+  boost::mpi::communicator world_ = ppc::core::mpi::Comm();
 };
 
 }  // namespace chernova_n_word_count_mpi
\ No newline at end of file
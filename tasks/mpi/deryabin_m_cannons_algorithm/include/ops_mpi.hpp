@@ -6,6 +6,7 @@
 #include <utility>
 #include <vector>
 
+#include "core/mpi/include/comm_mpi.hpp"
 #include "core/task/include/task.hpp"
 
 namespace deryabin_m_cannons_algorithm_mpi {
@@ -54,6 +55,6 @@ class CannonsAlgorithmMPITaskParallel : public ppc::core::Task {
   unsigned short dimension_ = 0;
   unsigned short block_dimension_ = 0;
   unsigned short block_rows_columns_ = 0;
-  boost::mpi::communicator world_;
+  boost::mpi::communicator world_ = ppc::core::mpi::Comm();
 };
 }  // namespace deryabin_m_cannons_algorithm_mpi
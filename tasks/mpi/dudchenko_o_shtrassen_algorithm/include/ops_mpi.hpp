@@ -9,6 +9,7 @@
 #include <utility>
 #include <vector>
 
+#include "core/mpi/include/comm_mpi.hpp"
 #include "core/task/include/task.hpp"
 
 namespace dudchenko_o_shtrassen_algorithm_mpi {
@@ -51,7 +52,7 @@ class StrassenAlgoriphmParallel : public ppc::core::Task {
   std::vector<double> result_;
   size_t size_;
 
-  boost::mpi::communicator world_;
+  boost::mpi::communicator world_ = ppc::core::mpi::Comm();
 };
 
 std::vector<double> Add(const std::vector<double>& a, const std::vector<double>& b, size_t n);
@@ -6,6 +6,7 @@
 #include <memory>
 #include <utility>
 
+#include "core/mpi/include/comm_mpi.hpp"
 #include "core/task/include/task.hpp"
 
 namespace dudchenko_o_sleeping_barber_mpi {
@@ -38,7 +39,7 @@ class TestMPISleepingBarber : public ppc::core::Task {
  private:
   int max_wait_{};
   int result_{};
-  boost::mpi::communicator world_;
+  boost::mpi::communicator world_ = ppc::core::mpi::Comm();
 
   void NextClient(int client);
   void HandleSmallWorld();
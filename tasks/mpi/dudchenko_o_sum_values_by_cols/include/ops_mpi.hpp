@@ -5,6 +5,7 @@
 #include <utility>
 #include <vector>
 
+#include "core/mpi/include/comm_mpi.hpp"
 #include "core/task/include/task.hpp"
 
 namespace dudchenko_o_sum_values_by_cols_mpi {
@@ -20,7 +21,7 @@ class SumValByColsMpi : public ppc::core::Task {
   std::vector<int> input_, local_input_;
   unsigned int rows_, cols_;
   std::vector<int> sum_;
-  boost::mpi::communicator world_;
+  boost::mpi::communicator world_ = ppc::core::mpi::Comm();
 };
 
 }  // namespace dudchenko_o_sum_values_by_cols_mpi
\ No newline at end of file
@@ -4,11 +4,14 @@
 
 #include <mpi.h>
 
+#include <boost/mpi/communicator.hpp>
 #include <cstddef>
 #include <random>
 #include <stdexcept>
 #include <vector>
 
+#include "core/mpi/include/comm_mpi.hpp"
+
 std::vector<int> GetRandomMatrix(std::size_t row_count, std::size_t column_count) {
   std::random_device rd;
   std::mt19937 gen(rd());
@@ -52,10 +55,11 @@ std::vector<int> GetParallelOperations(const std::vector<int>& matrix1, const st
     throw std::invalid_argument("Invalid dimensions for matrix2");
   }
 
+  const boost::mpi::communicator world = ppc::core::mpi::Comm();
   int size = 0;
   int rank = 0;
-  MPI_Comm_size(MPI_COMM_WORLD, &size);
-  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  MPI_Comm_size(world, &size);
+  MPI_Comm_rank(world, &rank);
 
   if (size == 1) {
     return GetSequentialOperations(matrix1, matrix2, a_rows, a_cols, b_cols);
@@ -79,10 +83,10 @@ std::vector<int> GetParallelOperations(const std::vector<int>& matrix1, const st
 
   std::vector<int> local_matrix1(local_rows * a_cols);
   MPI_Scatterv(matrix1.data(), sendcounts.data(), displs.data(), MPI_INT, local_matrix1.data(), sendcounts[rank],
-               MPI_INT, 0, MPI_COMM_WORLD);
+               MPI_INT, 0, world);
 
   std::vector<int> local_matrix2(matrix2);
-  MPI_Bcast(local_matrix2.data(), static_cast<int>(a_cols * b_cols), MPI_INT, 0, MPI_COMM_WORLD);
+  MPI_Bcast(local_matrix2.data(), static_cast<int>(a_cols * b_cols), MPI_INT, 0, world);
 
   std::vector<int> local_result(local_rows * b_cols, 0);
   for (std::size_t i = 0; i < local_rows; i++) {
@@ -112,6 +116,6 @@ std::vector<int> GetParallelOperations(const std::vector<int>& matrix1, const st
     global_result.resize(a_rows * b_cols);
   }
   MPI_Gatherv(local_result.data(), static_cast<int>(local_result.size()), MPI_INT, global_result.data(),
-              recvcounts.data(), rdispls.data(), MPI_INT, 0, MPI_COMM_WORLD);
+              recvcounts.data(), rdispls.data(), MPI_INT, 0, world);
   return global_result;
 }
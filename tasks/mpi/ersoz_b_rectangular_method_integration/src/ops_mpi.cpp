@@ -4,11 +4,14 @@
 
 #include <mpi.h>
 
+#include <boost/mpi/communicator.hpp>
 #include <cmath>
 #include <cstddef>
 #include <functional>
 #include <stdexcept>
 
+#include "core/mpi/include/comm_mpi.hpp"
+
 namespace {
 double IntegrateSequential(const std::function<double(double)>& integrable_function, double a, double b, size_t count) {
   if (count == 0) {
@@ -36,10 +39,11 @@ double GetIntegralRectangularMethodParallel(const std::function<double(double)>&
     throw std::runtime_error("Zero rectangles count");
   }
 
+  const boost::mpi::communicator world = ppc::core::mpi::Comm();
   int rank = 0;
   int process_count = 0;
-  MPI_Comm_size(MPI_COMM_WORLD, &process_count);
-  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  MPI_Comm_size(world, &process_count);
+  MPI_Comm_rank(world, &rank);
 
   double delta = (b - a) / static_cast<double>(count);
   size_t part = count / static_cast<size_t>(process_count);
@@ -53,7 +57,7 @@ double GetIntegralRectangularMethodParallel(const std::function<double(double)>&
   local_result *= delta;
 
   double global_result = 0.0;
-  MPI_Reduce(&local_result, &global_result, 1, MPI_DOUBLE, MPI_SUM, 0, MPI_COMM_WORLD);
+  MPI_Reduce(&local_result, &global_result, 1, MPI_DOUBLE, MPI_SUM, 0, world);
 
   return global_result;
 }
@@ -5,6 +5,7 @@
 #include <utility>
 #include <vector>
 
+#include "core/mpi/include/comm_mpi.hpp"
 #include "core/task/include/task.hpp"
 
 namespace nesterov_a_test_task_mpi {
@@ -20,7 +21,7 @@ class TestTaskMPI : public ppc::core::Task {
  private:
   std::vector<int> input_, output_;
   int rc_size_{};
-  boost::mpi::communicator world_;
+  boost::mpi::communicator world_ = ppc::core::mpi::Comm();
 };
 
 }  // namespace nesterov_a_test_task_mpi
\ No newline at end of file
@@ -7,6 +7,7 @@
 #include <memory>
 #include <utility>
 
+#include "core/mpi/include/comm_mpi.hpp"
 #include "core/task/include/task.hpp"
 
 namespace kabalova_v_strongin_mpi {
@@ -43,7 +44,7 @@ class TestMPITaskParallel : public ppc::core::Task {
   double right_{};
   std::function<double(double *)> f_;
   std::pair<double, double> result_;
-  boost::mpi::communicator world_;
+  boost::mpi::communicator world_ = ppc::core::mpi::Comm();
 };
 
 }  // namespace kabalova_v_strongin_mpi
\ No newline at end of file
@@ -4,6 +4,7 @@
 #include <utility>
 #include <vector>
 
+#include "core/mpi/include/comm_mpi.hpp"
 #include "core/task/include/task.hpp"
 
 namespace kalinin_d_odd_even_shell_mpi {
@@ -22,7 +23,7 @@ class OddEvenShellMpi : public ppc::core::Task {
  private:
   std::vector<int> input_;
   std::vector<int> output_;
-  boost::mpi::communicator world_;
+  boost::mpi::communicator world_ = ppc::core::mpi::Comm();
 };
 void GimmeRandVec(std::vector<int>& vec);
 
@@ -4,11 +4,13 @@
 #include <chrono>
 #include <cstdint>
 #include <memory>
+#include <optional>
 #include <vector>
 
 #include "boost/mpi/communicator.hpp"
 #include "core/perf/include/perf.hpp"
 #include "core/task/include/task.hpp"
+#include "core/util/include/data_cache.hpp"
 #include "mpi/kalinin_d_odd_even_shellsort/include/header_mpi_odd_even_shell.hpp"
 
 TEST(kalinin_d_odd_even_shellsort_mpi, test_pipeline_run) {
@@ -17,14 +19,14 @@ TEST(kalinin_d_odd_even_shellsort_mpi, test_pipeline_run) {
   boost::mpi::communicator world;
 
   // Create data
-  std::vector<int> arr;
+  std::optional<ppc::util::CachedData<int>> arr;
   std::vector<int> out;
   auto task_data_mpi = std::make_shared<ppc::core::TaskData>();
   if (world.rank() == 0) {
-    arr.resize(n);
+    arr = ppc::util::LoadCachedRandom<int>("kalinin_d_odd_even_shellsort", n, 0, n);
     out.resize(n);
-    task_data_mpi->inputs.emplace_back(reinterpret_cast<uint8_t *>(arr.data()));
-    task_data_mpi->inputs_count.emplace_back(arr.size());
+    task_data_mpi->inputs.emplace_back(reinterpret_cast<uint8_t *>(arr->Data()));
+    task_data_mpi->inputs_count.emplace_back(arr->Size());
     task_data_mpi->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
     task_data_mpi->outputs_count.emplace_back(out.size());
   }
@@ -48,8 +50,9 @@ TEST(kalinin_d_odd_even_shellsort_mpi, test_pipeline_run) {
   // Create Perf analyzer
   if (world.rank() == 0) {
     ppc::core::Perf::PrintPerfStatistic(perf_results);
-    std::ranges::sort(arr.begin(), arr.end());
-    ASSERT_EQ(arr, out);
+    auto expected = arr->ToVector();
+    std::ranges::sort(expected);
+    ASSERT_EQ(expected, out);
   }
 }
 
@@ -59,14 +62,14 @@ TEST(kalinin_d_odd_even_shellsort_mpi, test_task_run) {
   boost::mpi::communicator world;
 
   // Create data
-  std::vector<int> arr;
+  std::optional<ppc::util::CachedData<int>> arr;
   std::vector<int> out;
   auto task_data_mpi = std::make_shared<ppc::core::TaskData>();
   if (world.rank() == 0) {
-    arr.resize(n);
+    arr = ppc::util::LoadCachedRandom<int>("kalinin_d_odd_even_shellsort", n, 0, n);
     out.resize(n);
-    task_data_mpi->inputs.emplace_back(reinterpret_cast<uint8_t *>(arr.data()));
-    task_data_mpi->inputs_count.emplace_back(arr.size());
+    task_data_mpi->inputs.emplace_back(reinterpret_cast<uint8_t *>(arr->Data()));
+    task_data_mpi->inputs_count.emplace_back(arr->Size());
     task_data_mpi->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
     task_data_mpi->outputs_count.emplace_back(out.size());
   }
@@ -91,7 +94,8 @@ TEST(kalinin_d_odd_even_shellsort_mpi, test_task_run) {
   // Create Perf analyzer
   if (world.rank() == 0) {
     ppc::core::Perf::PrintPerfStatistic(perf_results);
-    std::ranges::sort(arr.begin(), arr.end());
-    ASSERT_EQ(arr, out);
+    auto expected = arr->ToVector();
+    std::ranges::sort(expected);
+    ASSERT_EQ(expected, out);
   }
 }
@@ -6,6 +6,7 @@
 #include <utility>
 #include <vector>
 
+#include "core/mpi/include/comm_mpi.hpp"
 #include "core/task/include/task.hpp"
 
 namespace kalinin_d_vector_dot_product_mpi {
@@ -38,7 +39,7 @@ class TestMPITaskParallel : public ppc::core::Task {
   std::vector<int> counts_;
   int num_processes_ = 0;
   int res_{};
-  boost::mpi::communicator world_;
+  boost::mpi::communicator world_ = ppc::core::mpi::Comm();
 };
 
 }  // namespace kalinin_d_vector_dot_product_mpi
\ No newline at end of file
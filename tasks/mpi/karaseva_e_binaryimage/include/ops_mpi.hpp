@@ -4,10 +4,12 @@
 #include <boost/mpi/communicator.hpp>
 #include <map>
 #include <set>
+#include <span>
 #include <sstream>
 #include <utility>
 #include <vector>
 
+#include "core/mpi/include/comm_mpi.hpp"
 #include "core/task/include/task.hpp"
 
 namespace karaseva_e_binaryimage_mpi {
@@ -17,7 +19,7 @@ int GetRootLabel(std::map<int, std::set<int>>& label_parent_map, int label);
 void PropagateLabelEquivalences(std::map<int, std::set<int>>& label_parent_map);
 void UpdateLabels(std::vector<int>& labeled_image, int rows, int cols);
 void UnionLabels(std::map<int, std::set<int>>& label_parent_map, int new_label, int neighbour_label);
-void Labeling(std::vector<int>& input_image, std::vector<int>& labeled_image, int rows, int cols, int min_label,
+void Labeling(std::span<const int> input_image, std::vector<int>& labeled_image, int rows, int cols, int min_label,
               std::map<int, std::set<int>>& label_parent_map);
 void SaveLabelMapToStream(std::ostringstream& oss, const std::map<int, std::set<int>>& label_map);
 void LoadLabelMapFromStream(std::istringstream& iss, std::map<int, std::set<int>>& label_map);
@@ -34,7 +36,7 @@ class TestMPITaskSequential : public ppc::core::Task {
   bool PostProcessingImpl() override;
 
  private:
-  std::vector<int> image_;
+  std::span<const int> image_;
   std::vector<int> labeled_image_;
   int rows_;
   int columns_;
@@ -49,11 +51,12 @@ class TestMPITaskParallel : public ppc::core::Task {
   bool PostProcessingImpl() override;
 
  private:
-  std::vector<int> image_, local_image_;
+  std::span<const int> image_;
+  std::vector<int> local_image_;
   std::vector<int> labeled_image_;
   int rows_;
   int columns_;
-  boost::mpi::communicator world_;
+  boost::mpi::communicator world_ = ppc::core::mpi::Comm();
 };
 
 }  // namespace karaseva_e_binaryimage_mpi
\ No newline at end of file
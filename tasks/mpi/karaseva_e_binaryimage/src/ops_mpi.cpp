@@ -10,6 +10,7 @@
 #include <map>
 #include <numeric>
 #include <set>
+#include <span>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -86,17 +87,21 @@ void karaseva_e_binaryimage_mpi::UnionLabels(std::map<int, std::set<int>>& label
 }
 // NOLINTBEGIN
 // Function to perform connected-component labeling using a sequential scan approach.
-void karaseva_e_binaryimage_mpi::Labeling(std::vector<int>& input_image, std::vector<int>& labeled_image, int rows,
-                                          int cols, int min_label, std::map<int, std::set<int>>& label_parent_map) {
+void karaseva_e_binaryimage_mpi::Labeling(std::span<const int> input_image, std::vector<int>& labeled_image,
+                                          int rows, int cols, int min_label,
+                                          std::map<int, std::set<int>>& label_parent_map) {
   int current_label = min_label;
   int dx[] = {-1, 0, -1};
   int dy[] = {0, -1, 1};
+  // one buffer for the whole scan: a pixel has at most three labeled neighbors
+  std::vector<int> neighbors;
+  neighbors.reserve(3);
 
   for (int x = 0; x < rows; x++) {
     for (int y = 0; y < cols; y++) {
       int position = (x * cols) + y;
       if (input_image[position] == 0 || labeled_image[position] > 1) {
-        std::vector<int> neighbors;
+        neighbors.clear();
 
         for (int i = 0; i < 3; i++) {
           int nx = x + dx[i];
@@ -140,9 +145,8 @@ bool karaseva_e_binaryimage_mpi::TestMPITaskSequential::PreProcessingImpl() {
   rows_ = static_cast<int>(task_data->inputs_count[0]);
   columns_ = static_cast<int>(task_data->inputs_count[1]);
   int pixel_count = rows_ * columns_;
-  image_ = std::vector<int>(pixel_count);
-  auto* input_ptr = reinterpret_cast<int*>(task_data->inputs[0]);
-  std::copy(input_ptr, input_ptr + pixel_count, image_.begin());
+  // inputs_count holds the shape of the image, so the view is sized by the pixel count
+  image_ = std::span<const int>(task_data->GetInput<int>(0).data(), pixel_count);
 
   labeled_image_ = std::vector<int>(rows_ * columns_, 1);
   return true;
@@ -151,7 +155,7 @@ bool karaseva_e_binaryimage_mpi::TestMPITaskSequential::PreProcessingImpl() {
 bool karaseva_e_binaryimage_mpi::TestMPITaskSequential::ValidationImpl() {
   int tmp_rows = static_cast<int>(task_data->inputs_count[0]);
   int tmp_columns = static_cast<int>(task_data->inputs_count[1]);
-  auto* input_ptr = reinterpret_cast<int*>(task_data->inputs[0]);
+  const int* input_ptr = task_data->GetInput<int>(0).data();
 
   for (int x = 0; x < tmp_rows; x++) {
     for (int y = 0; y < tmp_columns; y++) {
@@ -174,7 +178,7 @@ bool karaseva_e_binaryimage_mpi::TestMPITaskSequential::RunImpl() {
 }
 
 bool karaseva_e_binaryimage_mpi::TestMPITaskSequential::PostProcessingImpl() {
-  auto* output_ptr = reinterpret_cast<int*>(task_data->outputs[0]);
+  int* output_ptr = task_data->GetOutput<int>(0).data();
   std::ranges::copy(labeled_image_.begin(), labeled_image_.end(), output_ptr);
   return true;
 }
@@ -184,9 +188,7 @@ bool karaseva_e_binaryimage_mpi::TestMPITaskParallel::PreProcessingImpl() {
     rows_ = static_cast<int>(task_data->inputs_count[0]);
     columns_ = static_cast<int>(task_data->inputs_count[1]);
     int pixel_count = rows_ * columns_;
-    image_ = std::vector<int>(pixel_count);
-    auto* input_ptr = reinterpret_cast<int*>(task_data->inputs[0]);
-    std::ranges::copy(input_ptr, input_ptr + pixel_count, image_.begin());
+    image_ = std::span<const int>(task_data->GetInput<int>(0).data(), pixel_count);
 
     labeled_image_ = std::vector<int>(rows_ * columns_, 1);
   }
@@ -198,7 +200,7 @@ bool karaseva_e_binaryimage_mpi::TestMPITaskParallel::ValidationImpl() {
   if (world_.rank() == 0) {
     int tmp_rows = static_cast<int>(task_data->inputs_count[0]);
     int tmp_columns = static_cast<int>(task_data->inputs_count[1]);
-    auto* input_ptr = reinterpret_cast<int*>(task_data->inputs[0]);
+    const int* input_ptr = task_data->GetInput<int>(0).data();
 
     for (int x = 0; x < tmp_rows; x++) {
       for (int y = 0; y < tmp_columns; y++) {
@@ -269,7 +271,7 @@ bool karaseva_e_binaryimage_mpi::TestMPITaskParallel::RunImpl() {
   }
 
   local_image_ = std::vector<int>(partition_sizes[world_.rank()]);
-  boost::mpi::scatterv(world_, image_, partition_sizes, local_image_.data(), 0);
+  boost::mpi::scatterv(world_, image_.data(), partition_sizes, local_image_.data(), 0);
 
   std::vector<int> local_labeled_image(partition_sizes[world_.rank()], 1);
   int min_label = (100000 * world_.rank()) + 2;
@@ -318,7 +320,7 @@ bool karaseva_e_binaryimage_mpi::TestMPITaskParallel::RunImpl() {
 
 bool karaseva_e_binaryimage_mpi::TestMPITaskParallel::PostProcessingImpl() {
   if (world_.rank() == 0) {
-    auto* output_ptr = reinterpret_cast<int*>(task_data->outputs[0]);
+    int* output_ptr = task_data->GetOutput<int>(0).data();
     std::ranges::copy(labeled_image_.begin(), labeled_image_.end(), output_ptr);
   }
   return true;
@@ -5,6 +5,7 @@
 #include <utility>
 #include <vector>
 
+#include "core/mpi/include/comm_mpi.hpp"
 #include "core/task/include/task.hpp"
 
 namespace karaseva_e_num_of_alternations_signs_mpi {
@@ -20,7 +21,7 @@ class AlternatingSignsMPI : public ppc::core::Task {
  private:
   std::vector<int> input_, output_;
   int total_{};
-  boost::mpi::communicator world_;
+  boost::mpi::communicator world_ = ppc::core::mpi::Comm();
 };
 
 }  // namespace karaseva_e_num_of_alternations_signs_mpi
\ No newline at end of file
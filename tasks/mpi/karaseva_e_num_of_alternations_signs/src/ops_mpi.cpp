@@ -30,7 +30,7 @@ bool karaseva_e_num_of_alternations_signs_mpi::AlternatingSignsMPI::RunImpl() {
   if (rank == 0) {
     input_size = task_data->inputs_count[0];
   }
-  MPI_Bcast(&input_size, 1, MPI_UNSIGNED, 0, MPI_COMM_WORLD);
+  MPI_Bcast(&input_size, 1, MPI_UNSIGNED, 0, world_);
 
   std::vector<int> recv_counts(size, static_cast<int>(input_size / size));
   for (int i = 0; i < static_cast<int>(input_size % size); ++i) {
@@ -42,12 +42,12 @@ bool karaseva_e_num_of_alternations_signs_mpi::AlternatingSignsMPI::RunImpl() {
   if (rank == 0) {
     int offset = recv_counts[0];
     for (int proc = 1; proc < size; ++proc) {
-      MPI_Send(input_.data() + offset, recv_counts[proc], MPI_INT, proc, 0, MPI_COMM_WORLD);
+      MPI_Send(input_.data() + offset, recv_counts[proc], MPI_INT, proc, 0, world_);
       offset += recv_counts[proc];
     }
     local_input.assign(input_.begin(), input_.begin() + recv_counts[0]);
   } else {
-    MPI_Recv(local_input.data(), recv_counts[rank], MPI_INT, 0, 0, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+    MPI_Recv(local_input.data(), recv_counts[rank], MPI_INT, 0, 0, world_, MPI_STATUS_IGNORE);
   }
 
   std::vector<int> local_signs(local_input.size());
@@ -64,17 +64,17 @@ bool karaseva_e_num_of_alternations_signs_mpi::AlternatingSignsMPI::RunImpl() {
 
   int left_neighbor = 0;
   if (rank > 0) {
-    MPI_Recv(&left_neighbor, 1, MPI_INT, rank - 1, 0, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+    MPI_Recv(&left_neighbor, 1, MPI_INT, rank - 1, 0, world_, MPI_STATUS_IGNORE);
     if (left_neighbor != local_signs.front()) {
       ++local_count;
     }
   }
   if (rank < size - 1) {
-    MPI_Send(&local_signs.back(), 1, MPI_INT, rank + 1, 0, MPI_COMM_WORLD);
+    MPI_Send(&local_signs.back(), 1, MPI_INT, rank + 1, 0, world_);
   }
 
   int global_count = 0;
-  MPI_Reduce(&local_count, &global_count, 1, MPI_INT, MPI_SUM, 0, MPI_COMM_WORLD);
+  MPI_Reduce(&local_count, &global_count, 1, MPI_INT, MPI_SUM, 0, world_);
 
   if (rank == 0) {
     total_ = global_count;
@@ -6,9 +6,11 @@
 #include <mpi.h>
 
 #include <boost/mpi/collectives.hpp>
+#include <boost/mpi/communicator.hpp>
 #include <utility>
 #include <vector>
 
+#include "core/mpi/include/comm_mpi.hpp"
 #include "core/task/include/task.hpp"
 
 namespace karaseva_e_reduce_mpi {
@@ -35,6 +37,7 @@ class TestTaskMPI : public ppc::core::Task {
   int rank_;
   int root_;
   MPI_Datatype mpi_type_;
+  boost::mpi::communicator world_ = ppc::core::mpi::Comm();
 };
 
 }  // namespace karaseva_e_reduce_mpi
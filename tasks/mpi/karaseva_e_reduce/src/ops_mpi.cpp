@@ -15,8 +15,8 @@ namespace karaseva_e_reduce_mpi {
 
 template <typename T>
 bool TestTaskMPI<T>::PreProcessingImpl() {
-  MPI_Comm_rank(MPI_COMM_WORLD, &rank_);
-  MPI_Comm_size(MPI_COMM_WORLD, &size_);
+  MPI_Comm_rank(world_, &rank_);
+  MPI_Comm_size(world_, &size_);
 
   if constexpr (std::is_same_v<T, int>) {
     mpi_type_ = MPI_INT;
@@ -55,15 +55,15 @@ bool TestTaskMPI<T>::PreProcessingImpl() {
       if (proc == rank_) {
         local_input_.assign(input_.begin() + offset, input_.begin() + offset + counts[proc]);
       } else {
-        MPI_Send(&counts[proc], 1, MPI_INT, proc, 0, MPI_COMM_WORLD);
-        MPI_Send(input_.data() + offset, counts[proc], mpi_type_, proc, 0, MPI_COMM_WORLD);
+        MPI_Send(&counts[proc], 1, MPI_INT, proc, 0, world_);
+        MPI_Send(input_.data() + offset, counts[proc], mpi_type_, proc, 0, world_);
       }
       offset += counts[proc];
     }
   } else {
-    MPI_Recv(&local_size_, 1, MPI_INT, root_, 0, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+    MPI_Recv(&local_size_, 1, MPI_INT, root_, 0, world_, MPI_STATUS_IGNORE);
     local_input_.resize(local_size_);
-    MPI_Recv(local_input_.data(), local_size_, mpi_type_, root_, 0, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+    MPI_Recv(local_input_.data(), local_size_, mpi_type_, root_, 0, world_, MPI_STATUS_IGNORE);
   }
 
   return true;
@@ -93,13 +93,13 @@ bool TestTaskMPI<T>::RunImpl() {
       int partner_rank = (partner_vr + root_) % size_;
 
       T recv_data;
-      MPI_Recv(&recv_data, 1, mpi_type_, partner_rank, 0, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+      MPI_Recv(&recv_data, 1, mpi_type_, partner_rank, 0, world_, MPI_STATUS_IGNORE);
       result += recv_data;
     } else {
       int partner_vr = vr - step;
       int partner_rank = (partner_vr + root_) % size_;
 
-      MPI_Send(&result, 1, mpi_type_, partner_rank, 0, MPI_COMM_WORLD);
+      MPI_Send(&result, 1, mpi_type_, partner_rank, 0, world_);
       break;
     }
     step *= 2;
@@ -8,6 +8,7 @@
 #include <utility>
 #include <vector>
 
+#include "core/mpi/include/comm_mpi.hpp"
 #include "core/task/include/task.hpp"
 
 namespace kavtorev_d_most_different_neighbor_elements_mpi {
@@ -39,7 +40,7 @@ class MostDifferentNeighborElementsMpi : public ppc::core::Task {
   std::pair<int, int> res_;
   size_t size_;
   size_t st_;
-  boost::mpi::communicator world_;
+  boost::mpi::communicator world_ = ppc::core::mpi::Comm();
 };
 
 }  // namespace kavtorev_d_most_different_neighbor_elements_mpi
\ No newline at end of file
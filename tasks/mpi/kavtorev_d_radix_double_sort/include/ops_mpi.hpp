@@ -8,6 +8,7 @@
 #include <utility>
 #include <vector>
 
+#include "core/mpi/include/comm_mpi.hpp"
 #include "core/task/include/task.hpp"
 
 namespace kavtorev_d_radix_double_sort {
@@ -39,7 +40,7 @@ class RadixSortParallel : public ppc::core::Task {
  private:
   std::vector<double> data_;
   int n_ = 0;
-  boost::mpi::communicator world_;
+  boost::mpi::communicator world_ = ppc::core::mpi::Comm();
 
   static void RadixSortDoubles(std::vector<double>& data);
   static void RadixSortUint64(std::vector<uint64_t>& keys);
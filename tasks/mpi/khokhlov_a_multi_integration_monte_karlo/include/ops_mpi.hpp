@@ -6,6 +6,7 @@
 #include <utility>
 #include <vector>
 
+#include "core/mpi/include/comm_mpi.hpp"
 #include "core/task/include/task.hpp"
 
 namespace khokhlov_a_multi_integration_monte_karlo_mpi {
@@ -21,7 +22,7 @@ class MonteCarloMpi : public ppc::core::Task {
   std::function<double(const std::vector<double>&)> integrand;
 
  private:
-  boost::mpi::communicator world_;
+  boost::mpi::communicator world_ = ppc::core::mpi::Comm();
   unsigned int dimension_;
   unsigned int N_;
   std::vector<double> lower_bound_, local_l_bound_;
@@ -5,6 +5,7 @@
 #include <utility>
 #include <vector>
 
+#include "core/mpi/include/comm_mpi.hpp"
 #include "core/task/include/task.hpp"
 
 namespace khokhlov_a_sum_values_by_rows_mpi {
@@ -20,7 +21,7 @@ class SumValByRowsMpi : public ppc::core::Task {
   std::vector<int> input_, local_input_;
   unsigned int row_, col_;
   std::vector<int> sum_;
-  boost::mpi::communicator world_;
+  boost::mpi::communicator world_ = ppc::core::mpi::Comm();
 };
 
 }  // namespace khokhlov_a_sum_values_by_rows_mpi
\ No newline at end of file
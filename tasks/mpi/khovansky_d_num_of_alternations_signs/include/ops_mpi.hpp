@@ -4,6 +4,7 @@
 #include <utility>
 #include <vector>
 
+#include "core/mpi/include/comm_mpi.hpp"
 #include "core/task/include/task.hpp"
 
 namespace khovansky_d_num_of_alternations_signs_mpi {
@@ -33,6 +34,6 @@ class NumOfAlternationsSignsMpi : public ppc::core::Task {
   std::vector<int> input_;
   std::vector<int> start_;
   int res_{};
-  boost::mpi::communicator world_;
+  boost::mpi::communicator world_ = ppc::core::mpi::Comm();
 };
 }  // namespace khovansky_d_num_of_alternations_signs_mpi
\ No newline at end of file
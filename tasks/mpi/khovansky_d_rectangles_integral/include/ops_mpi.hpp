@@ -6,6 +6,7 @@
 #include <utility>
 #include <vector>
 
+#include "core/mpi/include/comm_mpi.hpp"
 #include "core/task/include/task.hpp"
 
 namespace khovansky_d_rectangles_integral_mpi {
@@ -21,7 +22,7 @@ class RectanglesMpi : public ppc::core::Task {
   std::function<double(const std::vector<double>&)> integrand_function;
 
  private:
-  boost::mpi::communicator world_;
+  boost::mpi::communicator world_ = ppc::core::mpi::Comm();
   unsigned int num_dimensions_;
   unsigned int num_partitions_;
   std::vector<double> lower_limits_;
@@ -7,6 +7,7 @@
 #include <utility>
 #include <vector>
 
+#include "core/mpi/include/comm_mpi.hpp"
 #include "core/task/include/task.hpp"
 
 namespace komshina_d_grid_torus_topology_mpi {
@@ -20,7 +21,7 @@ class TestTaskMPI : public ppc::core::Task {
   bool PostProcessingImpl() override;
 
  private:
-  boost::mpi::communicator world_;
+  boost::mpi::communicator world_ = ppc::core::mpi::Comm();
   boost::mpi::status status_;
   static std::vector<int> ComputeNeighbors(int rank, int grid_size);
 };
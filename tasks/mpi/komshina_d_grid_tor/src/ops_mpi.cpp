@@ -27,7 +27,7 @@ bool komshina_d_grid_torus_topology_mpi::TestTaskMPI::ValidationImpl() {
     return false;
   }
 
-  int size = boost::mpi::communicator().size();
+  int size = world_.size();
   int sqrt_size = static_cast<int>(std::sqrt(size));
   return sqrt_size * sqrt_size == size;
 
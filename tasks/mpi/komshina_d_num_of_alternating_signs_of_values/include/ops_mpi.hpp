@@ -5,6 +5,7 @@
 #include <utility>
 #include <vector>
 
+#include "core/mpi/include/comm_mpi.hpp"
 #include "core/task/include/task.hpp"
 
 namespace komshina_d_num_of_alternations_signs_mpi {
@@ -19,7 +20,7 @@ class TestTaskMPI : public ppc::core::Task {
  private:
   std::vector<int> input_, local_input_;
   int result_{};
-  boost::mpi::communicator world_;
+  boost::mpi::communicator world_ = ppc::core::mpi::Comm();
 };
 
 }  // namespace komshina_d_num_of_alternations_signs_mpi
\ No newline at end of file
@@ -33,8 +33,8 @@ bool komshina_d_num_of_alternations_signs_mpi::TestTaskMPI::RunImpl() {
     remainder = input_size % world_.size();
   }
 
-  MPI_Bcast(&delta, 1, MPI_UNSIGNED, 0, MPI_COMM_WORLD);
-  MPI_Bcast(&remainder, 1, MPI_UNSIGNED, 0, MPI_COMM_WORLD);
+  MPI_Bcast(&delta, 1, MPI_UNSIGNED, 0, world_);
+  MPI_Bcast(&remainder, 1, MPI_UNSIGNED, 0, world_);
 
   std::vector<int> local_input;
   const auto local_size = static_cast<std::size_t>(delta) + (world_.rank() == world_.size() - 1 ? remainder : 0);
@@ -44,11 +44,11 @@ bool komshina_d_num_of_alternations_signs_mpi::TestTaskMPI::RunImpl() {
     for (int proc = 1; proc < world_.size(); ++proc) {
       const std::size_t send_count = delta + (proc == world_.size() - 1 ? remainder : 0);
       MPI_Send(input_.data() + (proc * static_cast<int>(delta)), static_cast<int>(send_count), MPI_INT, proc, 0,
-               MPI_COMM_WORLD);
+               world_);
     }
   } else {
     local_input.resize(local_size);
-    MPI_Recv(local_input.data(), static_cast<int>(local_size), MPI_INT, 0, 0, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+    MPI_Recv(local_input.data(), static_cast<int>(local_size), MPI_INT, 0, 0, world_, MPI_STATUS_IGNORE);
   }
 
   int local_count = 0;
@@ -62,7 +62,7 @@ bool komshina_d_num_of_alternations_signs_mpi::TestTaskMPI::RunImpl() {
 
   if (world_.rank() > 0) {
     int prev_value = 0;
-    MPI_Recv(&prev_value, 1, MPI_INT, world_.rank() - 1, 0, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+    MPI_Recv(&prev_value, 1, MPI_INT, world_.rank() - 1, 0, world_, MPI_STATUS_IGNORE);
     if (!local_input.empty() && prev_value * local_input[0] < 0) {
       ++local_count;
     }
@@ -70,11 +70,11 @@ bool komshina_d_num_of_alternations_signs_mpi::TestTaskMPI::RunImpl() {
 
   if (world_.rank() < world_.size() - 1) {
     const int last_value = local_input.empty() ? 0 : local_input.back();
-    MPI_Send(&last_value, 1, MPI_INT, world_.rank() + 1, 0, MPI_COMM_WORLD);
+    MPI_Send(&last_value, 1, MPI_INT, world_.rank() + 1, 0, world_);
   }
 
   int global_count = 0;
-  MPI_Reduce(&local_count, &global_count, 1, MPI_INT, MPI_SUM, 0, MPI_COMM_WORLD);
+  MPI_Reduce(&local_count, &global_count, 1, MPI_INT, MPI_SUM, 0, world_);
 
   if (world_.rank() == 0) {
     result_ = global_count;
@@ -6,6 +6,7 @@
 #include <utility>
 #include <vector>
 
+#include "core/mpi/include/comm_mpi.hpp"
 #include "core/task/include/task.hpp"
 
 namespace komshina_d_sort_radius_for_real_numbers_with_simple_merge_mpi {
@@ -24,7 +25,7 @@ class TestTaskMPI : public ppc::core::Task {
 
   static void SortDoubles(std::vector<double>& arr);
   static void SortUint64(std::vector<uint64_t>& keys);
-  boost::mpi::communicator world_;
+  boost::mpi::communicator world_ = ppc::core::mpi::Comm();
 };
 
 }  // namespace komshina_d_sort_radius_for_real_numbers_with_simple_merge_mpi
\ No newline at end of file
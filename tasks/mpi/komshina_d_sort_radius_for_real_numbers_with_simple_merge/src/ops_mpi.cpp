@@ -21,7 +21,7 @@ bool komshina_d_sort_radius_for_real_numbers_with_simple_merge_mpi::TestTaskMPI:
 
 bool komshina_d_sort_radius_for_real_numbers_with_simple_merge_mpi::TestTaskMPI::ValidationImpl() {
   int rank = 0;
-  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  MPI_Comm_rank(world_, &rank);
   bool is_valid = (rank == 0);
 
   if (is_valid) {
@@ -30,16 +30,16 @@ bool komshina_d_sort_radius_for_real_numbers_with_simple_merge_mpi::TestTaskMPI:
                task_data->outputs_count[0] == static_cast<size_t>(total_size_);
   }
 
-  MPI_Bcast(&is_valid, 1, MPI_C_BOOL, 0, MPI_COMM_WORLD);
-  MPI_Bcast(&total_size_, 1, MPI_INT, 0, MPI_COMM_WORLD);
+  MPI_Bcast(&is_valid, 1, MPI_C_BOOL, 0, world_);
+  MPI_Bcast(&total_size_, 1, MPI_INT, 0, world_);
   return is_valid;
 }
 
 bool komshina_d_sort_radius_for_real_numbers_with_simple_merge_mpi::TestTaskMPI::RunImpl() {
   int rank = 0;
   int size = 0;
-  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
-  MPI_Comm_size(MPI_COMM_WORLD, &size);
+  MPI_Comm_rank(world_, &rank);
+  MPI_Comm_size(world_, &size);
 
   int chunk_size = total_size_ / size;
   int remainder = total_size_ % size;
@@ -56,7 +56,7 @@ bool komshina_d_sort_radius_for_real_numbers_with_simple_merge_mpi::TestTaskMPI:
 
   std::vector<double> local_data(sizes[rank]);
   MPI_Scatterv(numbers_.data(), sizes.data(), offsets.data(), MPI_DOUBLE, local_data.data(), sizes[rank], MPI_DOUBLE, 0,
-               MPI_COMM_WORLD);
+               world_);
 
   SortDoubles(local_data);
 
@@ -66,9 +66,9 @@ bool komshina_d_sort_radius_for_real_numbers_with_simple_merge_mpi::TestTaskMPI:
       int partner = rank + step;
       if (partner < size) {
         int partner_size = 0;
-        MPI_Recv(&partner_size, 1, MPI_INT, partner, 0, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+        MPI_Recv(&partner_size, 1, MPI_INT, partner, 0, world_, MPI_STATUS_IGNORE);
         std::vector<double> partner_data(partner_size);
-        MPI_Recv(partner_data.data(), partner_size, MPI_DOUBLE, partner, 1, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+        MPI_Recv(partner_data.data(), partner_size, MPI_DOUBLE, partner, 1, world_, MPI_STATUS_IGNORE);
         std::vector<double> merged;
         merged.reserve(local_data.size() + partner_data.size());
         std::ranges::merge(local_data, partner_data, std::back_inserter(merged));
@@ -76,8 +76,8 @@ bool komshina_d_sort_radius_for_real_numbers_with_simple_merge_mpi::TestTaskMPI:
       }
     } else if (rank % (2 * step) == step) {
       int local_size = static_cast<int>(local_data.size());
-      MPI_Send(&local_size, 1, MPI_INT, rank - step, 0, MPI_COMM_WORLD);
-      MPI_Send(local_data.data(), static_cast<int>(local_data.size()), MPI_DOUBLE, rank - step, 1, MPI_COMM_WORLD);
+      MPI_Send(&local_size, 1, MPI_INT, rank - step, 0, world_);
+      MPI_Send(local_data.data(), static_cast<int>(local_data.size()), MPI_DOUBLE, rank - step, 1, world_);
       local_data.clear();
     }
     step *= 2;
@@ -91,7 +91,7 @@ bool komshina_d_sort_radius_for_real_numbers_with_simple_merge_mpi::TestTaskMPI:
 
 bool komshina_d_sort_radius_for_real_numbers_with_simple_merge_mpi::TestTaskMPI::PostProcessingImpl() {
   int rank = 0;
-  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  MPI_Comm_rank(world_, &rank);
   if (rank == 0) {
     std::memcpy(task_data->outputs[0], numbers_.data(), total_size_ * sizeof(double));
   }
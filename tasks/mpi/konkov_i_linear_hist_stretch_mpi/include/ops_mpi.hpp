@@ -6,6 +6,7 @@
 #include <utility>
 #include <vector>
 
+#include "core/mpi/include/comm_mpi.hpp"
 #include "core/task/include/task.hpp"
 
 namespace konkov_i_linear_hist_stretch_mpi {
@@ -21,7 +22,7 @@ class LinearHistStretchMPI : public ppc::core::Task {
  private:
   std::vector<uint8_t> input_, output_;
   uint8_t min_intensity_, max_intensity_;
-  boost::mpi::communicator world_;
+  boost::mpi::communicator world_ = ppc::core::mpi::Comm();
 
   std::pair<uint8_t, uint8_t> ComputeLocalMinMax();
   void ApplyLinearStretch();
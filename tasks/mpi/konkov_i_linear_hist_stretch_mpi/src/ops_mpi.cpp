@@ -20,8 +20,6 @@ bool konkov_i_linear_hist_stretch_mpi::LinearHistStretchMPI::PreProcessingImpl()
 }
 
 bool konkov_i_linear_hist_stretch_mpi::LinearHistStretchMPI::ValidationImpl() {
-  boost::mpi::communicator comm;
-
   if (task_data->inputs_count.empty() || task_data->outputs_count.empty()) {
     return false;
   }
@@ -34,7 +32,7 @@ bool konkov_i_linear_hist_stretch_mpi::LinearHistStretchMPI::ValidationImpl() {
     return false;
   }
 
-  if (comm.rank() == 0) {
+  if (world_.rank() == 0) {
     if (task_data->inputs[0] == nullptr || task_data->outputs[0] == nullptr) {
       return false;
     }
@@ -6,6 +6,7 @@
 #include <utility>
 #include <vector>
 
+#include "core/mpi/include/comm_mpi.hpp"
 #include "core/task/include/task.hpp"
 
 namespace leontev_n_average_mpi {
@@ -21,7 +22,7 @@ class MPIVecAvgParallel : public ppc::core::Task {
  private:
   std::vector<int> input_, local_input_;
   int res_{};
-  boost::mpi::communicator world_;
+  boost::mpi::communicator world_ = ppc::core::mpi::Comm();
 };
 
 }  // namespace leontev_n_average_mpi
@@ -9,6 +9,7 @@
 #include <utility>
 #include <vector>
 
+#include "core/mpi/include/comm_mpi.hpp"
 #include "core/task/include/task.hpp"
 
 namespace leontev_n_binary_mpi {
@@ -29,7 +30,7 @@ class BinarySegmentsMPI : public ppc::core::Task {
                  std::vector<std::set<uint32_t>>& local_label_equivalences);
   void LocalLoopProcess(size_t row, size_t col, uint32_t& next_label, std::vector<uint32_t>& local_labels,
                         std::vector<std::set<uint32_t>>& local_label_equivalences);
-  boost::mpi::communicator world_;
+  boost::mpi::communicator world_ = ppc::core::mpi::Comm();
   std::vector<uint8_t> input_image_;
   std::vector<uint8_t> local_image_;
   std::vector<uint32_t> labels_;
@@ -7,6 +7,8 @@
 #include <vector>
 
 #include "boost/mpi/communicator.hpp"
+#include "core/mpi/include/distributed_mpi.hpp"
+#include "core/task/include/partition.hpp"
 #include "core/task/include/task.hpp"
 #include "mpi/makadrai_a_sobel/include/ops_mpi.hpp"
 
@@ -21,6 +23,24 @@ std::vector<int> RandomGenerateImg(int height_img, int width_img) {
   std::ranges::generate(img.begin(), img.end(), [&]() { return ras(gen); });
   return img;
 }
+
+std::vector<int> RunSobelSeq(std::vector<int> &img, int height_img, int width_img) {
+  std::vector<int> res(height_img * width_img);
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(img.data()));
+  task_data->inputs_count.emplace_back(width_img);
+  task_data->inputs_count.emplace_back(height_img);
+  task_data->outputs.emplace_back(reinterpret_cast<uint8_t *>(res.data()));
+  task_data->outputs_count.emplace_back(width_img);
+  task_data->outputs_count.emplace_back(height_img);
+
+  makadrai_a_sobel_mpi::SobelSeq sobel_seq(task_data);
+  EXPECT_TRUE(sobel_seq.Validation());
+  sobel_seq.PreProcessing();
+  sobel_seq.Run();
+  sobel_seq.PostProcessing();
+  return res;
+}
 }  // namespace
 
 TEST(makadrai_a_sobel_mpi, test_2_2) {
@@ -326,4 +346,53 @@ TEST(makadrai_a_sobel_mpi, test_random_100_50) {
 
     EXPECT_EQ(ans, res);
   }
-}
\ No newline at end of file
+}
+TEST(makadrai_a_sobel_mpi, test_distributed_pipeline) {
+  boost::mpi::communicator world;
+  int height_img = 37;
+  int width_img = 23;
+  std::vector<int> img;
+  std::vector<int> res;
+
+  // first stage: the image comes from rank 0, the result stays distributed by rows
+  auto rows = std::make_shared<const ppc::core::Partition>(
+      ppc::core::Partition::Rows(height_img, width_img, world.size()));
+  ppc::core::mpi::DistributedBuffer<int> edges(world, rows);
+  auto first_data = std::make_shared<ppc::core::TaskData>();
+  if (world.rank() == 0) {
+    img = RandomGenerateImg(height_img, width_img);
+    first_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(img.data()));
+    first_data->inputs_count.emplace_back(width_img);
+    first_data->inputs_count.emplace_back(height_img);
+  }
+  edges.AddAsOutput(*first_data, world);
+
+  makadrai_a_sobel_mpi::Sobel first(first_data);
+  ASSERT_TRUE(first.Validation());
+  first.PreProcessing();
+  first.Run();
+  first.PostProcessing();
+
+  // second stage reads the distributed rows in place and gathers its result to rank 0
+  auto second_data = std::make_shared<ppc::core::TaskData>();
+  edges.AddAsInput(*second_data, world);
+  if (world.rank() == 0) {
+    res.resize(height_img * width_img);
+    second_data->outputs.emplace_back(reinterpret_cast<uint8_t *>(res.data()));
+    second_data->outputs_count.emplace_back(width_img);
+    second_data->outputs_count.emplace_back(height_img);
+  }
+
+  makadrai_a_sobel_mpi::Sobel second(second_data);
+  ASSERT_TRUE(second.Validation());
+  second.PreProcessing();
+  second.Run();
+  second.PostProcessing();
+
+  auto first_res = ppc::core::mpi::Materialize(world, edges);
+  if (world.rank() == 0) {
+    auto ans = RunSobelSeq(img, height_img, width_img);
+    EXPECT_EQ(ans, first_res);
+    EXPECT_EQ(RunSobelSeq(ans, height_img, width_img), res);
+  }
+}
@@ -2,13 +2,18 @@
 
 #include <boost/mpi/collectives.hpp>
 #include <boost/mpi/communicator.hpp>
+#include <memory>
 #include <utility>
 #include <vector>
 
+#include "core/mpi/include/comm_mpi.hpp"
+#include "core/task/include/partition.hpp"
 #include "core/task/include/task.hpp"
 
 namespace makadrai_a_sobel_mpi {
 
+// The image and the result can be held whole on rank 0 or distributed by rows (TaskData::AddDistributedInput/
+// AddDistributedOutput with the width as the row size); distributed data stays on the processes.
 class Sobel : public ppc::core::Task {
  public:
   explicit Sobel(ppc::core::TaskDataPtr task_data) : Task(std::move(task_data)) {}
@@ -24,7 +29,14 @@ class Sobel : public ppc::core::Task {
 
   std::vector<int> img_;
   std::vector<int> simg_;
-  boost::mpi::communicator world_;
+  boost::mpi::communicator world_ = ppc::core::mpi::Comm();
+
+  // rows computed by every process
+  std::shared_ptr<const ppc::core::Partition> rows_;
+  const ppc::core::Partition *input_partition_ = nullptr;
+  const ppc::core::Partition *output_partition_ = nullptr;
+
+  [[nodiscard]] std::vector<int> LocalPaddedImage();
 };
 
 class SobelSeq : public ppc::core::Task {
@@ -42,7 +54,7 @@ class SobelSeq : public ppc::core::Task {
 
   std::vector<int> img_;
   std::vector<int> simg_;
-  boost::mpi::communicator world_;
+  boost::mpi::communicator world_ = ppc::core::mpi::Comm();
 };
 
 }  // namespace makadrai_a_sobel_mpi
\ No newline at end of file
@@ -7,20 +7,51 @@
 #include <boost/mpi/collectives/scatterv.hpp>
 #include <boost/mpi/operations.hpp>
 #include <cmath>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <utility>
 #include <vector>
 
+#include "core/mpi/include/distributed_mpi.hpp"
+#include "core/task/include/partition.hpp"
+
 bool makadrai_a_sobel_mpi::Sobel::PreProcessingImpl() {
-  if (world_.rank() == 0) {
-    height_img_ = (int)task_data->inputs_count[1];
-    width_img_ = (int)task_data->inputs_count[0];
+  input_partition_ = task_data->InputPartition(0);
+  output_partition_ = task_data->OutputPartition(0);
+
+  if (input_partition_ != nullptr) {
+    height_img_ = static_cast<int>(input_partition_->Rows());
+    width_img_ = static_cast<int>(input_partition_->RowSize());
+  } else {
+    if (world_.rank() == 0) {
+      height_img_ = (int)task_data->inputs_count[1];
+      width_img_ = (int)task_data->inputs_count[0];
+    }
+
+    boost::mpi::broadcast(world_, height_img_, 0);
+    boost::mpi::broadcast(world_, width_img_, 0);
   }
 
-  boost::mpi::broadcast(world_, height_img_, 0);
-  boost::mpi::broadcast(world_, width_img_, 0);
+  if (input_partition_ != nullptr) {
+    rows_ = std::make_shared<const ppc::core::Partition>(*input_partition_);
+  } else if (output_partition_ != nullptr) {
+    rows_ = std::make_shared<const ppc::core::Partition>(*output_partition_);
+  } else {
+    // rank 0 takes the remainder rows, the others equal blocks
+    int del = height_img_;
+    int ost = height_img_;
+    if (world_.size() != 1) {
+      del = height_img_ / (world_.size() - 1);
+      ost = height_img_ % (world_.size() - 1);
+    }
+    std::vector<uint64_t> counts(world_.size(), static_cast<uint64_t>(del) * width_img_);
+    counts[0] = static_cast<uint64_t>(ost) * width_img_;
+    rows_ = std::make_shared<const ppc::core::Partition>(ppc::core::Partition::FromCounts(counts, width_img_));
+  }
 
-  if (world_.rank() == 0) {
+  if (world_.rank() == 0 && input_partition_ == nullptr) {
     img_.resize((width_img_ + peding_) * (height_img_ + peding_));
-    simg_.resize(width_img_ * height_img_, 0);
     const auto* in = reinterpret_cast<int*>(task_data->inputs[0]);
 
     for (int i = 0; i < height_img_; i++) {
@@ -28,56 +59,88 @@ bool makadrai_a_sobel_mpi::Sobel::PreProcessingImpl() {
                 img_.begin() + (((i + 1) * (width_img_ + peding_)) + 1));
     }
   }
+  if (world_.rank() == 0 && output_partition_ == nullptr) {
+    simg_.resize(width_img_ * height_img_, 0);
+  }
 
   return true;
 }
 
 bool makadrai_a_sobel_mpi::Sobel::ValidationImpl() {
-  bool status = false;
-  if (world_.rank() == 0) {
-    status = task_data->outputs_count[0] == task_data->inputs_count[0] &&
-             task_data->outputs_count[1] == task_data->inputs_count[1] && task_data->inputs_count[0] > 0 &&
-             task_data->inputs_count[1] > 0;
+  const auto* in_part = task_data->InputPartition(0);
+  const auto* out_part = task_data->OutputPartition(0);
+  bool status = true;
+  if (in_part != nullptr) {
+    status = in_part->Parts() == world_.size() && in_part->Rows() > 0;
+    if (out_part == nullptr && world_.rank() == 0) {
+      status = status && task_data->outputs_count[0] == in_part->RowSize() &&
+               task_data->outputs_count[1] == in_part->Rows();
+    }
+  } else if (world_.rank() == 0) {
+    status = task_data->inputs_count[0] > 0 && task_data->inputs_count[1] > 0;
+    if (out_part == nullptr) {
+      status = status && task_data->outputs_count[0] == task_data->inputs_count[0] &&
+               task_data->outputs_count[1] == task_data->inputs_count[1];
+    }
+  }
+  if (out_part != nullptr) {
+    status = status && out_part->Parts() == world_.size();
+    if (in_part != nullptr) {
+      status = status && *out_part == *in_part;
+    } else if (world_.rank() == 0) {
+      status = status && out_part->RowSize() == task_data->inputs_count[0] &&
+               out_part->Rows() == task_data->inputs_count[1];
+    }
   }
-  boost::mpi::broadcast(world_, status, 0);
-  return status;
+  bool all_status = false;
+  boost::mpi::all_reduce(world_, status, all_status, std::logical_and<>());
+  return all_status;
 }
 
-bool makadrai_a_sobel_mpi::Sobel::RunImpl() {
-  int del = height_img_;
-  int ost = height_img_;
-
-  if (world_.size() != 1) {
-    del = height_img_ / (world_.size() - 1);
-    ost = height_img_ % (world_.size() - 1);
+std::vector<int> makadrai_a_sobel_mpi::Sobel::LocalPaddedImage() {
+  const int rank = world_.rank();
+  const int padded_width = width_img_ + peding_;
+  const auto local_height_img = static_cast<int>(rows_->Rows(rank));
+
+  if (input_partition_ == nullptr) {
+    // every process receives its rows of the padded image together with the rows around them
+    std::vector<int> send_counts(world_.size());
+    std::vector<int> displacements(world_.size());
+    for (int i = 0; i < world_.size(); i++) {
+      const auto rows = static_cast<int>(rows_->Rows(i));
+      send_counts[i] = rows == 0 ? 0 : (rows + peding_) * padded_width;
+      displacements[i] = static_cast<int>(rows_->FirstRow(i)) * padded_width;
+    }
+    std::vector<int> local_img(send_counts[rank]);
+    boost::mpi::scatterv(world_, img_, send_counts, displacements, local_img.data(), send_counts[rank], 0);
+    return local_img;
   }
 
-  std::vector<int> send_counts(world_.size(), (del + peding_) * (width_img_ + peding_));
-  std::vector<int> send_counts_res(world_.size(), del * width_img_);
-  if (ost != 0) {
-    send_counts[0] = (ost + peding_) * (width_img_ + peding_);
-    send_counts_res[0] = ost * width_img_;
-  } else {
-    send_counts[0] = 0;
-    send_counts_res[0] = 0;
+  // the rows are already distributed, only the neighbouring rows are received
+  auto local = task_data->GetInput<int>(0);
+  auto halo = ppc::core::mpi::ExchangeHaloRows(world_, local, *input_partition_);
+  std::vector<int> local_img(local_height_img == 0 ? 0 : (local_height_img + peding_) * padded_width, 0);
+  auto put_row = [&](int row, const int* values) {
+    std::copy(values, values + width_img_, local_img.begin() + (row * padded_width) + 1);
+  };
+  if (!halo.above.empty()) {
+    put_row(0, halo.above.data());
   }
-
-  std::vector<int> displacements_res(world_.size());
-  std::vector<int> displacements(world_.size());
-  if (world_.size() != 1) {
-    for (int i = 1; i < world_.size(); i++) {
-      displacements[i] = (i - 1) * del * (width_img_ + peding_) + ost * (width_img_ + peding_);
-      displacements_res[i] = (i - 1) * del * width_img_ + ost * width_img_;
-    }
+  for (int i = 0; i < local_height_img; i++) {
+    put_row(i + 1, local.data() + (i * width_img_));
   }
+  if (!halo.below.empty()) {
+    put_row(local_height_img + 1, halo.below.data());
+  }
+  return local_img;
+}
 
-  int local_height_img = (world_.rank() == 0) ? ost : del;
-  std::vector<int> local_img(send_counts[world_.rank()]);
+bool makadrai_a_sobel_mpi::Sobel::RunImpl() {
+  const auto local_height_img = static_cast<int>(rows_->Rows(world_.rank()));
+  std::vector<int> local_img = LocalPaddedImage();
   std::vector<int> local_simg(local_height_img * width_img_);
   int local_max_z = 1;
 
-  boost::mpi::scatterv(world_, img_, send_counts, displacements, local_img.data(), send_counts[world_.rank()], 0);
-
   if (local_height_img != 0) {
     for (int i = 1; i < local_height_img + 1; i++) {
       for (int j = 1; j < width_img_ + 1; j++) {
@@ -106,6 +169,21 @@ bool makadrai_a_sobel_mpi::Sobel::RunImpl() {
 
   boost::mpi::all_reduce(world_, local_max_z, max_z, boost::mpi::maximum<int>());
 
+  if (output_partition_ != nullptr) {
+    // the result stays distributed, every process scales its own rows
+    for (auto& value : local_simg) {
+      value = (int)(((double)value / max_z) * 255);
+    }
+    simg_ = std::move(local_simg);
+    return true;
+  }
+
+  std::vector<int> send_counts_res(world_.size());
+  std::vector<int> displacements_res(world_.size());
+  for (int i = 0; i < world_.size(); i++) {
+    send_counts_res[i] = static_cast<int>(rows_->Count(i));
+    displacements_res[i] = static_cast<int>(rows_->Offset(i));
+  }
   boost::mpi::gatherv(world_, local_simg.data(), local_height_img * width_img_, simg_.data(), send_counts_res,
                       displacements_res, 0);
 
@@ -121,7 +199,7 @@ bool makadrai_a_sobel_mpi::Sobel::RunImpl() {
 }
 
 bool makadrai_a_sobel_mpi::Sobel::PostProcessingImpl() {
-  if (world_.rank() == 0) {
+  if (world_.rank() == 0 || output_partition_ != nullptr) {
     std::ranges::copy(simg_, reinterpret_cast<int*>(task_data->outputs[0]));
   }
   return true;
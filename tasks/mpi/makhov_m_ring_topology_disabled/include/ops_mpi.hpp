@@ -9,6 +9,7 @@
 #include <utility>
 #include <vector>
 
+#include "core/mpi/include/comm_mpi.hpp"
 #include "core/task/include/task.hpp"
 std::vector<int32_t> GetRandVector(size_t size, int min_value, int max_value);
 
@@ -26,7 +27,7 @@ class TestMPITaskParallel : public ppc::core::Task {
   std::vector<int32_t> input_data_;
   std::vector<int32_t> output_data_;
   std::vector<int32_t> sequence_;
-  boost::mpi::communicator world_;
+  boost::mpi::communicator world_ = ppc::core::mpi::Comm();
 };
 
 }  // namespace makhov_m_ring_topology
\ No newline at end of file
@@ -5,6 +5,7 @@
 #include <utility>
 #include <vector>
 
+#include "core/mpi/include/comm_mpi.hpp"
 #include "core/task/include/task.hpp"
 
 namespace malyshev_v_lent_horizontal_mpi {
@@ -20,7 +21,7 @@ class MatVecMultMpi : public ppc::core::Task {
  private:
   std::vector<int> matrix_, vector_, local_matrix_, local_result_;
   unsigned int rows_{}, cols_{};
-  boost::mpi::communicator world_;
+  boost::mpi::communicator world_ = ppc::core::mpi::Comm();
 };
 
 }  // namespace malyshev_v_lent_horizontal_mpi
\ No newline at end of file
@@ -5,6 +5,7 @@
 #include <memory>
 #include <utility>
 
+#include "core/mpi/include/comm_mpi.hpp"
 #include "core/task/include/task.hpp"
 
 namespace mezhuev_m_lattice_torus_mpi {
@@ -19,7 +20,7 @@ class GridTorusTopologyParallel : public ppc::core::Task {
   bool PostProcessingImpl() override;
 
  private:
-  boost::mpi::communicator world_;
+  boost::mpi::communicator world_ = ppc::core::mpi::Comm();
 };
 
 }  // namespace mezhuev_m_lattice_torus_mpi
\ No newline at end of file
@@ -7,6 +7,7 @@
 #include <utility>
 #include <vector>
 
+#include "core/mpi/include/comm_mpi.hpp"
 #include "core/task/include/task.hpp"
 
 namespace mezhuev_m_most_different_neighbor_elements_mpi {
@@ -23,7 +24,7 @@ class MostDifferentNeighborElements : public ppc::core::Task {
   bool PostProcessingImpl() override;
 
  private:
-  boost::mpi::communicator world_;
+  boost::mpi::communicator world_ = ppc::core::mpi::Comm();
   std::vector<int> input_;
   std::pair<int, int> result_;
 };
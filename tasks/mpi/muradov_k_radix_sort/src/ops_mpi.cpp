@@ -4,10 +4,13 @@
 #include <mpi.h>
 
 #include <algorithm>
+#include <boost/mpi/communicator.hpp>
 #include <cstdlib>
 #include <ctime>
 #include <vector>
 
+#include "core/mpi/include/comm_mpi.hpp"
+
 namespace muradov_k_radix_sort {
 
 namespace {
@@ -94,10 +97,11 @@ std::vector<int> MergeTwoAscending(const std::vector<int>& a, const std::vector<
 }  // anonymous namespace
 
 void MpiRadixSort(std::vector<int>& v) {
+  const boost::mpi::communicator world = ppc::core::mpi::Comm();
   int proc_rank = 0;
   int proc_count = 0;
-  MPI_Comm_rank(MPI_COMM_WORLD, &proc_rank);
-  MPI_Comm_size(MPI_COMM_WORLD, &proc_count);
+  MPI_Comm_rank(world, &proc_rank);
+  MPI_Comm_size(world, &proc_count);
   if (proc_count <= 1 || static_cast<int>(v.size()) <= proc_count) {
     if (proc_rank == 0 && !v.empty()) {
       SequentialRadixSort(v);
@@ -131,10 +135,10 @@ void MpiRadixSort(std::vector<int>& v) {
   if (proc_rank == 0) {
     enlarged_size = static_cast<int>(v.size());
   }
-  MPI_Bcast(&enlarged_size, 1, MPI_INT, 0, MPI_COMM_WORLD);
+  MPI_Bcast(&enlarged_size, 1, MPI_INT, 0, world);
   int part_size = enlarged_size / proc_count;
   std::vector<int> local_array(part_size);
-  MPI_Scatter(v.data(), part_size, MPI_INT, local_array.data(), part_size, MPI_INT, 0, MPI_COMM_WORLD);
+  MPI_Scatter(v.data(), part_size, MPI_INT, local_array.data(), part_size, MPI_INT, 0, world);
   SequentialRadixSort(local_array);
   // Tree-based merge reduction (binary tree reduction handling variable sizes)
   int my_size = part_size;
@@ -144,17 +148,17 @@ void MpiRadixSort(std::vector<int>& v) {
       int src = proc_rank + step;
       if (src < proc_count) {
         int recv_size = 0;
-        MPI_Recv(&recv_size, 1, MPI_INT, src, 0, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+        MPI_Recv(&recv_size, 1, MPI_INT, src, 0, world, MPI_STATUS_IGNORE);
         std::vector<int> recv_array(recv_size);
-        MPI_Recv(recv_array.data(), recv_size, MPI_INT, src, 0, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+        MPI_Recv(recv_array.data(), recv_size, MPI_INT, src, 0, world, MPI_STATUS_IGNORE);
         std::vector<int> merged = MergeTwoAscending(local_array, recv_array);
         local_array = merged;
         my_size = static_cast<int>(local_array.size());
       }
     } else {
       int target = proc_rank - (proc_rank % (2 * step));
-      MPI_Send(&my_size, 1, MPI_INT, target, 0, MPI_COMM_WORLD);
-      MPI_Send(local_array.data(), my_size, MPI_INT, target, 0, MPI_COMM_WORLD);
+      MPI_Send(&my_size, 1, MPI_INT, target, 0, world);
+      MPI_Send(local_array.data(), my_size, MPI_INT, target, 0, world);
       break;
     }
     step *= 2;
@@ -7,6 +7,7 @@
 #include <utility>
 #include <vector>
 
+#include "core/mpi/include/comm_mpi.hpp"
 #include "core/task/include/task.hpp"
 
 namespace opolin_d_cg_method_mpi {
@@ -29,7 +30,7 @@ class CGMethodkMPI : public ppc::core::Task {
   std::vector<double> x_;
   size_t n_;
   double epsilon_;
-  boost::mpi::communicator world_;
+  boost::mpi::communicator world_ = ppc::core::mpi::Comm();
 };
 
 }  // namespace opolin_d_cg_method_mpi
\ No newline at end of file
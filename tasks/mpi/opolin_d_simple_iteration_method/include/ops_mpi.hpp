@@ -8,6 +8,7 @@
 #include <utility>
 #include <vector>
 
+#include "core/mpi/include/comm_mpi.hpp"
 #include "core/task/include/task.hpp"
 
 namespace opolin_d_simple_iteration_method_mpi {
@@ -32,7 +33,7 @@ class SimpleIterMethodkMPI : public ppc::core::Task {
   uint32_t n_;
   double epsilon_;
   int max_iters_;
-  boost::mpi::communicator world_;
+  boost::mpi::communicator world_ = ppc::core::mpi::Comm();
 };
 
 }  // namespace opolin_d_simple_iteration_method_mpi
\ No newline at end of file
@@ -7,6 +7,7 @@
 #include <utility>
 #include <vector>
 
+#include "core/mpi/include/comm_mpi.hpp"
 #include "core/task/include/task.hpp"
 
 namespace opolin_d_sum_by_columns_mpi {
@@ -24,7 +25,7 @@ class SumColumnsMatrixMPI : public ppc::core::Task {
   std::vector<int> output_;
   size_t rows_;
   size_t cols_;
-  boost::mpi::communicator world_;
+  boost::mpi::communicator world_ = ppc::core::mpi::Comm();
 };
 
 }  // namespace opolin_d_sum_by_columns_mpi
\ No newline at end of file
@@ -5,6 +5,7 @@
 #include <functional>
 #include <utility>
 
+#include "core/mpi/include/comm_mpi.hpp"
 #include "core/task/include/task.hpp"
 
 namespace prokhorov_n_rectangular_integration_mpi {
@@ -46,7 +47,7 @@ class TestTaskMPI : public ppc::core::Task {
   int n_{};
   double result_{};
   std::function<double(double)> f_;
-  boost::mpi::communicator world_;
+  boost::mpi::communicator world_ = ppc::core::mpi::Comm();
 };
 
 }  // namespace prokhorov_n_rectangular_integration_mpi
\ No newline at end of file
@@ -1,31 +1,109 @@
 #include <gtest/gtest.h>
+#include <mpi.h>
 
 #include <boost/mpi/communicator.hpp>
 #include <boost/mpi/environment.hpp>
+#include <cstdint>
 #include <cstdio>
 #include <cstdlib>
 #include <memory>
+#include <stdexcept>
 #include <string>
 #include <utility>
 
+#include "core/mpi/include/comm_mpi.hpp"
+#include "core/util/include/util.hpp"
+
+// Runs every test on a fresh duplicate of the world communicator, see ppc::core::mpi::Comm()
+class TestCommunicatorIsolation : public ::testing::EmptyTestEventListener {
+ public:
+  TestCommunicatorIsolation(boost::mpi::communicator com) : com_(std::move(com)) {}
+
+  void OnTestStart(const ::testing::TestInfo& /*test_info*/) override {
+    scope_ = std::make_unique<ppc::core::mpi::ScopedComm>(com_);
+  }
+  void OnTestEnd(const ::testing::TestInfo& /*test_info*/) override { scope_.reset(); }
+
+ private:
+  boost::mpi::communicator com_;
+  std::unique_ptr<ppc::core::mpi::ScopedComm> scope_;
+};
+
+// Fails the run if a test leaves a message in the queue of the world or of its own communicator. The check
+// mode is taken from PPC_MPI_MESSAGE_CHECK:
+//   fast (default)  local iprobe after every test and one all_reduce of the results; a message on the world still
+//                   in flight is reported after a later test, the final check at the end of the program waits for
+//                   all of them. The communicator of the test is freed after the test, so it is synchronized with
+//                   a barrier and checked right away
+//   strict          barrier before the iprobe, so the message is reported after the test that sent it
+//   off             no check
 class UnreadMessagesDetector : public ::testing::EmptyTestEventListener {
  public:
-  UnreadMessagesDetector(boost::mpi::communicator com) : com_(std::move(com)) {}
+  enum class Mode : uint8_t { kFast, kStrict, kOff };
+
+  UnreadMessagesDetector(boost::mpi::communicator com) : com_(std::move(com)), mode_(ModeFromEnv()) {}
 
   void OnTestEnd(const ::testing::TestInfo& test_info) override {
-    com_.barrier();
-    if (const auto msg = com_.iprobe(boost::mpi::any_source, boost::mpi::any_tag)) {
-      fprintf(
-          stderr,
-          "[  PROCESS %d  ] [  FAILED  ] %s.%s: MPI message queue has an unread message from process %d with tag %d\n",
-          com_.rank(), test_info.test_suite_name(), test_info.name(), msg->source(), msg->tag());
-      exit(2);
+    if (mode_ == Mode::kOff) {
+      return;
+    }
+    if (mode_ == Mode::kStrict) {
+      Barrier(com_);
+    }
+    const auto test_comm = ppc::core::mpi::Comm();
+    if (MPI_Comm(test_comm) != MPI_Comm(com_)) {
+      Barrier(test_comm);
+    }
+    Check(std::string(test_info.test_suite_name()) + "." + test_info.name());
+  }
+
+  void OnTestProgramEnd(const ::testing::UnitTest& /*unit_test*/) override {
+    if (mode_ == Mode::kFast) {
+      Barrier(com_);
+      Check("end of the test program");
     }
-    com_.barrier();
   }
 
  private:
+  static Mode ModeFromEnv() {
+    const auto mode = ppc::util::GetEnv("PPC_MPI_MESSAGE_CHECK");
+    if (mode.empty() || mode == "fast") {
+      return Mode::kFast;
+    }
+    if (mode == "strict") {
+      return Mode::kStrict;
+    }
+    if (mode == "off") {
+      return Mode::kOff;
+    }
+    throw std::invalid_argument("PPC_MPI_MESSAGE_CHECK must be fast, strict or off, got '" + mode + "'");
+  }
+
+  // The collectives of the check go to the PMPI_* entry points, so the MPI profiler does not count them in the
+  // breakdown of the test
+  static void Barrier(const boost::mpi::communicator& comm) { PMPI_Barrier(MPI_Comm(comm)); }
+
+  // the all_reduce also keeps processes in step, so every one of them stops if any has a message
+  void Check(const std::string& where) {
+    auto msg = com_.iprobe(boost::mpi::any_source, boost::mpi::any_tag);
+    if (!msg) {
+      msg = ppc::core::mpi::Comm().iprobe(boost::mpi::any_source, boost::mpi::any_tag);
+    }
+    if (msg) {
+      fprintf(stderr,
+              "[  PROCESS %d  ] [  FAILED  ] %s: MPI message queue has an unread message from process %d with tag %d\n",
+              com_.rank(), where.c_str(), msg->source(), msg->tag());
+    }
+    int unread = msg ? 1 : 0;
+    int any_unread = 0;
+    PMPI_Allreduce(&unread, &any_unread, 1, MPI_INT, MPI_MAX, MPI_Comm(com_));
+    if (any_unread != 0) {
+      exit(2);
+    }
+  }
+
   boost::mpi::communicator com_;
+  Mode mode_;
 };
 
 class WorkerTestFailurePrinter : public ::testing::EmptyTestEventListener {
@@ -67,6 +145,8 @@ int main(int argc, char** argv) {
     auto* listener = listeners.Release(listeners.default_result_printer());
     listeners.Append(new WorkerTestFailurePrinter(std::shared_ptr<::testing::TestEventListener>(listener), world));
   }
+  // listeners get OnTestEnd in reverse order, so the test communicator is probed before it is freed
+  listeners.Append(new TestCommunicatorIsolation(world));
   listeners.Append(new UnreadMessagesDetector(world));
 
   return RUN_ALL_TESTS();
@@ -5,6 +5,7 @@
 #include <utility>
 #include <vector>
 
+#include "core/mpi/include/comm_mpi.hpp"
 #include "core/task/include/task.hpp"
 
 namespace sharamygina_i_vector_dot_product_mpi {
@@ -22,7 +23,7 @@ class VectorDotProductMpi : public ppc::core::Task {
   std::vector<int> local_v1_;
   std::vector<int> local_v2_;
   int res_{};
-  boost::mpi::communicator world_;
+  boost::mpi::communicator world_ = ppc::core::mpi::Comm();
   unsigned int delta_;
 };
 }  // namespace sharamygina_i_vector_dot_product_mpi
\ No newline at end of file
@@ -7,6 +7,7 @@
 #include <utility>
 #include <vector>
 
+#include "core/mpi/include/comm_mpi.hpp"
 #include "core/task/include/task.hpp"
 
 namespace shishkarev_a_dijkstra_algorithm_mpi {
@@ -50,7 +51,7 @@ class TestMPITaskParallel : public ppc::core::Task {
   std::vector<int> row_ptr_;
   int st_{};
   int size_{};
-  boost::mpi::communicator world_;
+  boost::mpi::communicator world_ = ppc::core::mpi::Comm();
 };
 
 }  // namespace shishkarev_a_dijkstra_algorithm_mpi
\ No newline at end of file
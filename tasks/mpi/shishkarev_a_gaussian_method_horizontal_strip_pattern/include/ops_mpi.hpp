@@ -3,9 +3,11 @@
 #include <boost/mpi/collectives.hpp>
 #include <boost/mpi/communicator.hpp>
 #include <memory>
+#include <span>
 #include <utility>
 #include <vector>
 
+#include "core/mpi/include/comm_mpi.hpp"
 #include "core/task/include/task.hpp"
 
 namespace shishkarev_a_gaussian_method_horizontal_strip_pattern_mpi {
@@ -31,7 +33,7 @@ std::vector<double> GetRandomMatrix(int sz);
 
 bool IsSingular(const std::vector<double>& matrix, Matrix mat);
 
-double AxB(int n, int m, std::vector<double> a, std::vector<double> res);
+double AxB(int n, int m, std::span<const double> a, const std::vector<double>& res);
 
 void BroadcastMatrixSize(boost::mpi::communicator& world, int& rows, int& cols);
 
@@ -71,7 +73,7 @@ class MPIGaussHorizontalParallel : public ppc::core::Task {
  private:
   std::vector<double> matrix_, local_matrix_, res_, local_res_;
   int rows_{}, cols_{};
-  boost::mpi::communicator world_;
+  boost::mpi::communicator world_ = ppc::core::mpi::Comm();
 };
 
 }  // namespace shishkarev_a_gaussian_method_horizontal_strip_pattern_mpi
\ No newline at end of file
@@ -5,27 +5,18 @@
 #include <cmath>
 #include <cstdint>
 #include <memory>
-#include <random>
+#include <optional>
+#include <span>
 #include <vector>
 
 #include "core/perf/include/perf.hpp"
 #include "core/task/include/task.hpp"
+#include "core/util/include/data_cache.hpp"
 #include "mpi/shishkarev_a_gaussian_method_horizontal_strip_pattern/include/ops_mpi.hpp"
 
 namespace shishkarev_a_gaussian_method_horizontal_strip_pattern_mpi {
 
-std::vector<double> GetRandomMatrix(int sz) {
-  std::random_device dev;
-  std::mt19937 gen(dev());
-  std::uniform_real_distribution<double> dis(-1000, 1000);
-  std::vector<double> matrix(sz);
-  for (int i = 0; i < sz; ++i) {
-    matrix[i] = dis(gen);
-  }
-  return matrix;
-}
-
-double AxB(int n, int m, std::vector<double> a, std::vector<double> res) {
+double AxB(int n, int m, std::span<const double> a, const std::vector<double>& res) {
   std::vector<double> tmp(m, 0);
 
   for (int i = 0; i < m; ++i) {
@@ -49,15 +40,17 @@ TEST(shishkarev_a_gaussian_method_horizontal_strip_pattern_mpi, test_pipeline_ru
 
   const int cols = 101;
   const int rows = 100;
-  std::vector<double> global_matrix(cols * rows);
+  std::optional<ppc::util::CachedData<double>> global_matrix;
   std::vector<double> global_res(cols - 1, 0);
 
   std::shared_ptr<ppc::core::TaskData> task_data_par = std::make_shared<ppc::core::TaskData>();
 
   if (world.rank() == 0) {
-    global_matrix = shishkarev_a_gaussian_method_horizontal_strip_pattern_mpi::GetRandomMatrix(cols * rows);
-    task_data_par->inputs.emplace_back(reinterpret_cast<uint8_t*>(global_matrix.data()));
-    task_data_par->inputs_count.emplace_back(global_matrix.size());
+    // seeded and cached, so every run solves the same system
+    global_matrix = ppc::util::LoadCachedRandom<double>("shishkarev_a_gaussian_method_horizontal_strip_pattern",
+                                                        cols * rows, -1000, 1000);
+    task_data_par->inputs.emplace_back(reinterpret_cast<uint8_t*>(global_matrix->Data()));
+    task_data_par->inputs_count.emplace_back(global_matrix->Size());
     task_data_par->inputs_count.emplace_back(cols);
     task_data_par->inputs_count.emplace_back(rows);
     task_data_par->outputs.emplace_back(reinterpret_cast<uint8_t*>(global_res.data()));
@@ -83,8 +76,9 @@ TEST(shishkarev_a_gaussian_method_horizontal_strip_pattern_mpi, test_pipeline_ru
   perf_analyzer->PipelineRun(perf_attr, perf_results);
   if (world.rank() == 0) {
     ppc::core::Perf::PrintPerfStatistic(perf_results);
-    ASSERT_NEAR(shishkarev_a_gaussian_method_horizontal_strip_pattern_mpi::AxB(cols, rows, global_matrix, global_res),
-                0, 1e-6);
+    ASSERT_NEAR(
+        shishkarev_a_gaussian_method_horizontal_strip_pattern_mpi::AxB(cols, rows, global_matrix->Values(), global_res),
+        0, 1e-6);
   }
 }
 
@@ -93,15 +87,17 @@ TEST(shishkarev_a_gaussian_method_horizontal_strip_pattern_mpi, test_task_run) {
 
   const int cols = 101;
   const int rows = 100;
-  std::vector<double> global_matrix(cols * rows);
+  std::optional<ppc::util::CachedData<double>> global_matrix;
   std::vector<double> global_res(cols - 1, 0);
 
   std::shared_ptr<ppc::core::TaskData> task_data_par = std::make_shared<ppc::core::TaskData>();
 
   if (world.rank() == 0) {
-    global_matrix = shishkarev_a_gaussian_method_horizontal_strip_pattern_mpi::GetRandomMatrix(cols * rows);
-    task_data_par->inputs.emplace_back(reinterpret_cast<uint8_t*>(global_matrix.data()));
-    task_data_par->inputs_count.emplace_back(global_matrix.size());
+    // seeded and cached, so every run solves the same system
+    global_matrix = ppc::util::LoadCachedRandom<double>("shishkarev_a_gaussian_method_horizontal_strip_pattern",
+                                                        cols * rows, -1000, 1000);
+    task_data_par->inputs.emplace_back(reinterpret_cast<uint8_t*>(global_matrix->Data()));
+    task_data_par->inputs_count.emplace_back(global_matrix->Size());
     task_data_par->inputs_count.emplace_back(cols);
     task_data_par->inputs_count.emplace_back(rows);
     task_data_par->outputs.emplace_back(reinterpret_cast<uint8_t*>(global_res.data()));
@@ -127,7 +123,8 @@ TEST(shishkarev_a_gaussian_method_horizontal_strip_pattern_mpi, test_task_run) {
   perf_analyzer->TaskRun(perf_attr, perf_results);
   if (world.rank() == 0) {
     ppc::core::Perf::PrintPerfStatistic(perf_results);
-    ASSERT_NEAR(shishkarev_a_gaussian_method_horizontal_strip_pattern_mpi::AxB(cols, rows, global_matrix, global_res),
-                0, 1e-6);
+    ASSERT_NEAR(
+        shishkarev_a_gaussian_method_horizontal_strip_pattern_mpi::AxB(cols, rows, global_matrix->Values(), global_res),
+        0, 1e-6);
   }
 }
\ No newline at end of file
@@ -155,4 +155,76 @@ TEST(shishkarev_a_sum_of_vector_elements_mpi, test_negative_vector_sum) {
     int expected_sum = std::accumulate(global_vec.begin(), global_vec.end(), 0);
     ASSERT_EQ(global_sum[0], expected_sum);
   }
-}
\ No newline at end of file
+}
+
+TEST(shishkarev_a_sum_of_vector_elements_mpi, test_batch_sum) {
+  boost::mpi::environment env;
+  boost::mpi::communicator world;
+
+  const std::vector<int> sizes = {5, 0, 1, 997, 32, 3};
+  std::vector<std::vector<int>> global_vecs(sizes.size());
+  std::vector<std::vector<int32_t>> global_sums(sizes.size(), std::vector<int32_t>(1, 0));
+
+  std::vector<ppc::core::TaskDataPtr> batch;
+  for (size_t i = 0; i < sizes.size(); i++) {
+    auto task_data_par = std::make_shared<ppc::core::TaskData>();
+    if (world.rank() == 0) {
+      global_vecs[i] = GetRandomVector(sizes[i]);
+      task_data_par->inputs.emplace_back(reinterpret_cast<uint8_t*>(global_vecs[i].data()));
+      task_data_par->inputs_count.emplace_back(global_vecs[i].size());
+      task_data_par->outputs.emplace_back(reinterpret_cast<uint8_t*>(global_sums[i].data()));
+      task_data_par->outputs_count.emplace_back(global_sums[i].size());
+    }
+    batch.push_back(task_data_par);
+  }
+
+  shishkarev_a_sum_of_vector_elements_mpi::MPIVectorSumParallel parallel(batch.front());
+  auto results = parallel.RunBatch(batch);
+
+  ASSERT_EQ(results.size(), sizes.size());
+  if (world.rank() == 0) {
+    for (size_t i = 0; i < sizes.size(); i++) {
+      EXPECT_TRUE(results[i]);
+      EXPECT_EQ(global_sums[i][0], std::accumulate(global_vecs[i].begin(), global_vecs[i].end(), 0));
+    }
+  }
+}
+
+TEST(shishkarev_a_sum_of_vector_elements_mpi, test_batch_rejects_invalid_items) {
+  boost::mpi::environment env;
+  boost::mpi::communicator world;
+
+  std::vector<int> global_vec = GetRandomVector(10);
+  std::vector<int32_t> global_sum(1, 0);
+  std::vector<int32_t> wrong_sum(2, 0);
+  std::vector<double> wrong_type(10, 1.0);
+
+  // the second item has two outputs, the third one has no input and the last one holds doubles
+  std::vector<ppc::core::TaskDataPtr> batch;
+  const std::vector<std::vector<int32_t>*> outputs = {&global_sum, &wrong_sum, &global_sum, &global_sum};
+  for (size_t i = 0; i < outputs.size(); i++) {
+    auto* output = outputs[i];
+    auto task_data_par = std::make_shared<ppc::core::TaskData>();
+    if (world.rank() == 0) {
+      if (i == 3) {
+        task_data_par->AddInput(wrong_type);
+      } else if (i != 2) {
+        task_data_par->inputs.emplace_back(reinterpret_cast<uint8_t*>(global_vec.data()));
+        task_data_par->inputs_count.emplace_back(global_vec.size());
+      }
+      task_data_par->outputs.emplace_back(reinterpret_cast<uint8_t*>(output->data()));
+      task_data_par->outputs_count.emplace_back(output->size());
+    }
+    batch.push_back(task_data_par);
+  }
+
+  shishkarev_a_sum_of_vector_elements_mpi::MPIVectorSumParallel parallel(batch.front());
+  auto results = parallel.RunBatch(batch);
+
+  // every process reports the result of rank 0
+  EXPECT_EQ(results, std::vector<bool>({true, false, false, false}));
+  if (world.rank() == 0) {
+    EXPECT_EQ(global_sum[0], std::accumulate(global_vec.begin(), global_vec.end(), 0));
+    EXPECT_EQ(wrong_sum, std::vector<int32_t>(2, 0));
+  }
+}
@@ -8,6 +8,7 @@
 #include <utility>
 #include <vector>
 
+#include "core/mpi/include/comm_mpi.hpp"
 #include "core/task/include/task.hpp"
 
 namespace shishkarev_a_sum_of_vector_elements_mpi {
@@ -33,12 +34,13 @@ class MPIVectorSumParallel : public ppc::core::Task {
   bool ValidationImpl() override;
   bool RunImpl() override;
   bool PostProcessingImpl() override;
+  std::vector<bool> RunBatchImpl(const std::vector<ppc::core::TaskDataPtr>& batch) override;
 
  private:
   std::vector<int> input_vector_, local_vector_;
   int result_{}, local_sum_;
   std::string operation_;
-  boost::mpi::communicator world_;
+  boost::mpi::communicator world_ = ppc::core::mpi::Comm();
 };
 
 }  // namespace shishkarev_a_sum_of_vector_elements_mpi
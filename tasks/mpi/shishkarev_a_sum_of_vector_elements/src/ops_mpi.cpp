@@ -6,11 +6,17 @@
 #include <boost/mpi/collectives/reduce.hpp>
 #include <boost/mpi/collectives/scatterv.hpp>
 #include <boost/mpi/communicator.hpp>
+#include <cstddef>
 #include <cstring>
+#include <exception>
 #include <functional>
 #include <numeric>
 #include <vector>
 
+#include "core/mpi/include/batch_mpi.hpp"
+#include "core/task/include/batch.hpp"
+#include "core/task/include/task.hpp"
+
 bool shishkarev_a_sum_of_vector_elements_mpi::MPIVectorSumSequential::PreProcessingImpl() {
   input_vector_ = std::vector<int>(task_data->inputs_count[0]);
   int* input_ptr = reinterpret_cast<int*>(task_data->inputs[0]);
@@ -95,4 +101,47 @@ bool shishkarev_a_sum_of_vector_elements_mpi::MPIVectorSumParallel::PostProcessi
   }
 
   return true;
-}
\ No newline at end of file
+}
+
+std::vector<bool> shishkarev_a_sum_of_vector_elements_mpi::MPIVectorSumParallel::RunBatchImpl(
+    const std::vector<ppc::core::TaskDataPtr>& batch) {
+  // items are checked on rank 0 like ValidationImpl does; an invalid item contributes no values
+  std::vector<int> valid(batch.size(), 1);
+  ppc::core::PackedBatch<int> packed;
+  if (world_.rank() == 0) {
+    for (std::size_t i = 0; i < batch.size(); i++) {
+      const auto& data = *batch[i];
+      valid[i] = static_cast<int>(!data.inputs.empty() && !data.inputs_count.empty() && !data.outputs.empty() &&
+                                  !data.outputs_count.empty() && data.outputs_count[0] == 1);
+      if (valid[i] != 0) {
+        try {
+          auto input = data.GetInput<int>(0);
+          packed.values.insert(packed.values.end(), input.begin(), input.end());
+        } catch (const std::exception&) {
+          // e.g. an input registered with another element type; the other ranks learn it from `valid`
+          valid[i] = 0;
+        }
+      }
+      packed.offsets.push_back(packed.values.size());
+    }
+  }
+  boost::mpi::broadcast(world_, valid.data(), static_cast<int>(valid.size()), 0);
+
+  // one broadcast + scatterv + reduce for the whole batch instead of three collectives per vector
+  auto chunk = ppc::core::mpi::ScatterBatch(world_, packed);
+  std::vector<int> local_sums(chunk.Items(), 0);
+  chunk.ForEachItem([&](std::size_t item, auto values) {
+    local_sums[item] = std::accumulate(values.begin(), values.end(), 0);
+  });
+  std::vector<int> sums(chunk.Items(), 0);
+  boost::mpi::reduce(world_, local_sums.data(), static_cast<int>(local_sums.size()), sums.data(), std::plus<>(), 0);
+
+  std::vector<bool> results(batch.size());
+  for (std::size_t i = 0; i < batch.size(); i++) {
+    results[i] = valid[i] != 0;
+    if (world_.rank() == 0 && results[i]) {
+      *reinterpret_cast<int*>(batch[i]->outputs[0]) = sums[i];
+    }
+  }
+  return results;
+}
@@ -5,6 +5,7 @@
 #include <utility>
 #include <vector>
 
+#include "core/mpi/include/comm_mpi.hpp"
 #include "core/task/include/task.hpp"
 
 namespace shkurinskaya_e_fox_mat_mul_mpi {
@@ -25,7 +26,7 @@ class FoxMatMulMPI : public ppc::core::Task {
  private:
   std::vector<double> inputA_, inputB_, output_;
   int matrix_size_, root_, sz_, block_sz_;
-  boost::mpi::communicator world_;
+  boost::mpi::communicator world_ = ppc::core::mpi::Comm();
 };
 
 }  // namespace shkurinskaya_e_fox_mat_mul_mpi
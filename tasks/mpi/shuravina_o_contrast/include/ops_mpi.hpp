@@ -6,6 +6,7 @@
 #include <utility>
 #include <vector>
 
+#include "core/mpi/include/comm_mpi.hpp"
 #include "core/task/include/task.hpp"
 
 namespace shuravina_o_contrast {
@@ -21,7 +22,7 @@ class ContrastTaskMPI : public ppc::core::Task {
  private:
   std::vector<uint8_t> input_, output_;
   int rc_size_{};
-  boost::mpi::communicator world_;
+  boost::mpi::communicator world_ = ppc::core::mpi::Comm();
 
   void IncreaseContrast();
 };
@@ -8,6 +8,7 @@
 #include <utility>
 #include <vector>
 
+#include "core/mpi/include/comm_mpi.hpp"
 #include "core/task/include/task.hpp"
 
 namespace solovev_a_binary_image_marking {
@@ -58,6 +59,6 @@ class TestMPITaskParallel : public ppc::core::Task {
   std::vector<int> data_;
   std::vector<int> labels_;
   int m_, n_;
-  boost::mpi::communicator world_;
+  boost::mpi::communicator world_ = ppc::core::mpi::Comm();
 };
 }  // namespace solovev_a_binary_image_marking
\ No newline at end of file
@@ -4,6 +4,7 @@
 #include <utility>
 #include <vector>
 
+#include "core/mpi/include/comm_mpi.hpp"
 #include "core/task/include/task.hpp"
 
 namespace somov_i_num_of_alternations_signs_mpi {
@@ -16,7 +17,7 @@ class NumOfAlternationsSigns : public ppc::core::Task {
   bool PostProcessingImpl() override;
 
  private:
-  boost::mpi::communicator world_;
+  boost::mpi::communicator world_ = ppc::core::mpi::Comm();
   std::vector<int> input_;
   int sz_ = 0;
   int output_ = 0;
@@ -4,6 +4,7 @@
 #include <utility>
 #include <vector>
 
+#include "core/mpi/include/comm_mpi.hpp"
 #include "core/task/include/task.hpp"
 
 namespace somov_i_ribbon_hor_scheme_only_mat_a_mpi {
@@ -16,7 +17,7 @@ class RibbonHorSchemeOnlyMatA : public ppc::core::Task {
   bool PostProcessingImpl() override;
 
  private:
-  boost::mpi::communicator world_;
+  boost::mpi::communicator world_ = ppc::core::mpi::Comm();
   std::vector<int> a_;
   std::vector<int> b_;
   std::vector<int> c_;
@@ -2,9 +2,11 @@
 
 #include <boost/mpi/collectives.hpp>
 #include <boost/mpi/communicator.hpp>
+#include <span>
 #include <utility>
 #include <vector>
 
+#include "core/mpi/include/comm_mpi.hpp"
 #include "core/task/include/task.hpp"
 
 namespace strakhov_a_char_freq_counter_mpi {
@@ -18,10 +20,10 @@ class CharFreqCounterSeq : public ppc::core::Task {
   bool PostProcessingImpl() override;
 
  private:
-  std::vector<signed char> input_;
+  std::span<const signed char> input_;
   int result_{};
   char target_{};
-  boost::mpi::communicator world_;
+  boost::mpi::communicator world_ = ppc::core::mpi::Comm();
 };
 
 class CharFreqCounterPar : public ppc::core::Task {
@@ -33,10 +35,11 @@ class CharFreqCounterPar : public ppc::core::Task {
   bool PostProcessingImpl() override;
 
  private:
-  std::vector<signed char> input_, local_input_;
+  std::span<const signed char> input_;
+  std::vector<signed char> local_input_;
   int result_{}, local_result_{};
   char target_{};
-  boost::mpi::communicator world_;
+  boost::mpi::communicator world_ = ppc::core::mpi::Comm();
 };
 
 }  // namespace strakhov_a_char_freq_counter_mpi
\ No newline at end of file
@@ -5,18 +5,13 @@
 #include <boost/mpi/collectives/reduce.hpp>
 #include <boost/mpi/collectives/scatter.hpp>
 #include <boost/mpi/collectives/scatterv.hpp>
-#include <cstddef>
 #include <functional>
 #include <vector>
 //  Sequential
 
 bool strakhov_a_char_freq_counter_mpi::CharFreqCounterSeq::PreProcessingImpl() {
-  auto *tmp = reinterpret_cast<signed char *>(task_data->inputs[0]);
-  input_ = std::vector<signed char>(task_data->inputs_count[0]);
-  for (size_t i = 0; i < task_data->inputs_count[0]; i++) {
-    input_[i] = tmp[i];
-  }
-  target_ = *reinterpret_cast<char *>(task_data->inputs[1]);
+  input_ = task_data->GetInput<signed char>(0);
+  target_ = task_data->GetInput<char>(1)[0];
   result_ = 0;
   return true;
 }
@@ -31,7 +26,7 @@ bool strakhov_a_char_freq_counter_mpi::CharFreqCounterSeq::RunImpl() {
 }
 
 bool strakhov_a_char_freq_counter_mpi::CharFreqCounterSeq::PostProcessingImpl() {
-  reinterpret_cast<int *>(task_data->outputs[0])[0] = result_;
+  task_data->GetOutput<int>(0)[0] = result_;
   return true;
 }
 
@@ -39,13 +34,8 @@ bool strakhov_a_char_freq_counter_mpi::CharFreqCounterSeq::PostProcessingImpl()
 
 bool strakhov_a_char_freq_counter_mpi::CharFreqCounterPar::PreProcessingImpl() {
   if (world_.rank() == 0) {
-    input_.resize(task_data->inputs_count[0]);
-    auto *tmp = reinterpret_cast<signed char *>(task_data->inputs[0]);
-    input_ = std::vector<signed char>(task_data->inputs_count[0]);
-    for (size_t i = 0; i < task_data->inputs_count[0]; i++) {
-      input_[i] = tmp[i];
-    }
-    target_ = *reinterpret_cast<char *>(task_data->inputs[1]);
+    input_ = task_data->GetInput<signed char>(0);
+    target_ = task_data->GetInput<char>(1)[0];
   }
 
   result_ = 0;
@@ -87,7 +77,7 @@ bool strakhov_a_char_freq_counter_mpi::CharFreqCounterPar::RunImpl() {
       }
     }
   } else {
-    input_.clear();
+    input_ = {};
   }
 
   boost::mpi::scatter(world_, send_counts, local_input_size, 0);
@@ -102,7 +92,7 @@ bool strakhov_a_char_freq_counter_mpi::CharFreqCounterPar::RunImpl() {
 
 bool strakhov_a_char_freq_counter_mpi::CharFreqCounterPar::PostProcessingImpl() {
   if (world_.rank() == 0) {
-    reinterpret_cast<int *>(task_data->outputs[0])[0] = result_;
+    task_data->GetOutput<int>(0)[0] = result_;
   }
   return true;
 }
@@ -6,6 +6,7 @@
 #include <utility>
 #include <vector>
 
+#include "core/mpi/include/comm_mpi.hpp"
 #include "core/task/include/task.hpp"
 
 namespace strakhov_a_fox_algorithm_mpi {
@@ -21,7 +22,7 @@ class TestTaskMPI : public ppc::core::Task {
  private:
   std::vector<double> matrA_, matrB_, output_;
   size_t rc_size_{};
-  boost::mpi::communicator world_;
+  boost::mpi::communicator world_ = ppc::core::mpi::Comm();
 };
 
 }  // namespace strakhov_a_fox_algorithm_mpi
\ No newline at end of file
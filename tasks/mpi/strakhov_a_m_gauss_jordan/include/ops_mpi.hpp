@@ -6,6 +6,7 @@
 #include <utility>
 #include <vector>
 
+#include "core/mpi/include/comm_mpi.hpp"
 #include "core/task/include/task.hpp"
 
 namespace strakhov_a_m_gauss_jordan_mpi {
@@ -22,7 +23,7 @@ class TestTaskMPI : public ppc::core::Task {
   std::vector<double> output_;
   std::vector<double> input_;
   size_t row_size_, col_size_;
-  boost::mpi::communicator world_;
+  boost::mpi::communicator world_ = ppc::core::mpi::Comm();
 };
 
 }  // namespace strakhov_a_m_gauss_jordan_mpi
\ No newline at end of file
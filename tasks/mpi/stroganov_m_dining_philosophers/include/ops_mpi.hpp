@@ -5,6 +5,7 @@
 #include <boost/mpi/communicator.hpp>
 #include <utility>
 
+#include "core/mpi/include/comm_mpi.hpp"
 #include "core/task/include/task.hpp"
 
 namespace stroganov_m_dining_philosophers_mpi {
@@ -26,7 +27,7 @@ class DiningPhilosophersMPI : public ppc::core::Task {
   bool CheckAllThink();
 
  private:
-  boost::mpi::communicator world_;
+  boost::mpi::communicator world_ = ppc::core::mpi::Comm();
   int status_;
   int l_philosopher_;
   int r_philosopher_;
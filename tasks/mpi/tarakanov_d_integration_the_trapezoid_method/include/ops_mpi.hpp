@@ -6,6 +6,7 @@
 #include <memory>
 #include <utility>
 
+#include "core/mpi/include/comm_mpi.hpp"
 #include "core/task/include/task.hpp"
 
 namespace tarakanov_d_integration_the_trapezoid_method_mpi {
@@ -22,7 +23,7 @@ class IntegrationTheTrapezoidMethodMPI : public ppc::core::Task {
  private:
   double a_{}, b_{}, h_{}, res_{};
   static double FuncToIntegrate(double x) { return x / 2; };
-  boost::mpi::communicator world_;
+  boost::mpi::communicator world_ = ppc::core::mpi::Comm();
 };
 
 }  // namespace tarakanov_d_integration_the_trapezoid_method_mpi
\ No newline at end of file
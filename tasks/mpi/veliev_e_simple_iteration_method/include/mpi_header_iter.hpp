@@ -3,6 +3,7 @@
 #include <utility>
 #include <vector>
 
+#include "core/mpi/include/comm_mpi.hpp"
 #include "core/task/include/task.hpp"
 
 namespace veliev_e_simple_iteration_method_mpi {
@@ -25,7 +26,7 @@ class VelievSlaeIterMpi : public ppc::core::Task {
   std::vector<double> coeff_matrix_;
   double convergence_tolerance_;
   bool IsDiagonallyDominant();
-  boost::mpi::communicator world_;
+  boost::mpi::communicator world_ = ppc::core::mpi::Comm();
 
   double& MatrixAt(std::vector<double>& matrix, int row, int col) const { return matrix[(row * matrix_size_) + col]; }
 };
@@ -4,6 +4,7 @@
 #include <utility>
 #include <vector>
 
+#include "core/mpi/include/comm_mpi.hpp"
 #include "core/task/include/task.hpp"
 
 namespace veliev_e_sum_values_by_rows_matrix_mpi {
@@ -18,7 +19,7 @@ class SumValuesByRowsMatrixMpi : public ppc::core::Task {
  private:
   std::vector<int> input_, output_;
   int elem_total_, cols_total_, rows_total_;
-  boost::mpi::communicator world_;
+  boost::mpi::communicator world_ = ppc::core::mpi::Comm();
 };
 void GetRndMatrix(std::vector<int>& vec);
 void SeqProcForChecking(std::vector<int>& vec, int rows_size, std::vector<int>& output);
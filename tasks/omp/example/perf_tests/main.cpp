@@ -1,15 +1,62 @@
 #include <gtest/gtest.h>
+#include <omp.h>
 
 #include <chrono>
+#include <cmath>
 #include <cstddef>
 #include <cstdint>
+#include <iostream>
 #include <memory>
+#include <span>
+#include <utility>
 #include <vector>
 
 #include "core/perf/include/perf.hpp"
+#include "core/perf/include/sweep.hpp"
 #include "core/task/include/task.hpp"
 #include "omp/example/include/ops_omp.hpp"
 
+namespace {
+
+// Row-parallel matrix square: unlike the example task, the rows are split across the team,
+// so the sweep shows how the kernel scales with the thread count
+class ParallelMatMulTask : public ppc::core::Task {
+ public:
+  explicit ParallelMatMulTask(ppc::core::TaskDataPtr task_data) : Task(std::move(task_data)) {}
+  bool ValidationImpl() override {
+    const auto in = task_data->GetInput<int>(0);
+    const auto side = static_cast<size_t>(std::sqrt(static_cast<double>(in.size())));
+    return side * side == in.size() && task_data->GetOutput<int>(0).size() == in.size();
+  }
+  bool PreProcessingImpl() override {
+    in_ = task_data->GetInput<int>(0);
+    out_ = task_data->GetOutput<int>(0);
+    side_ = static_cast<int>(std::sqrt(static_cast<double>(in_.size())));
+    return true;
+  }
+  bool RunImpl() override {
+#pragma omp parallel for default(none)
+    for (int i = 0; i < side_; ++i) {
+      for (int j = 0; j < side_; ++j) {
+        int sum = 0;
+        for (int k = 0; k < side_; ++k) {
+          sum += in_[(i * side_) + k] * in_[(k * side_) + j];
+        }
+        out_[(i * side_) + j] = sum;
+      }
+    }
+    return true;
+  }
+  bool PostProcessingImpl() override { return true; }
+
+ private:
+  std::span<const int> in_;
+  std::span<int> out_;
+  int side_{};
+};
+
+}  // namespace
+
 TEST(nesterov_a_test_task_omp, test_pipeline_run) {
   constexpr int kCount = 300;
 
@@ -91,3 +138,30 @@ TEST(nesterov_a_test_task_omp, test_task_run) {
   ppc::core::Perf::PrintPerfStatistic(perf_results);
   ASSERT_EQ(in, out);
 }
+
+TEST(nesterov_a_test_task_omp, test_scaling_sweep) {
+  // size is the number of multiply-adds, so the weak scaling table keeps the work per thread constant
+  auto factory = [](uint64_t size) {
+    const auto count = static_cast<size_t>(std::cbrt(static_cast<double>(size)));
+    auto in = std::make_shared<std::vector<int>>(count * count, 1);
+    auto out = std::make_shared<std::vector<int>>(count * count, 0);
+
+    auto task_data_omp = std::make_shared<ppc::core::TaskData>();
+    task_data_omp->AddInput(in);
+    task_data_omp->AddOutput(out);
+    return ppc::core::SweepCase{.task = std::make_shared<ParallelMatMulTask>(task_data_omp),
+                                .data = std::make_shared<std::pair<decltype(in), decltype(out)>>(in, out)};
+  };
+
+  const int threads_before = omp_get_max_threads();
+  ppc::core::SweepConfig config;
+  config.sizes = {100 * 100 * 100, 150 * 150 * 150};
+  config.threads = {1, 2, 4};
+  config.set_threads = [](int threads) { omp_set_num_threads(threads); };
+  config.get_threads = [] { return omp_get_max_threads(); };
+
+  auto results = ppc::core::RunSweep(config, factory);
+  ppc::core::PrintSweep(std::cout, results);
+  ASSERT_EQ(results.strong.size(), config.sizes.size() * config.threads.size());
+  EXPECT_EQ(omp_get_max_threads(), threads_before);
+}
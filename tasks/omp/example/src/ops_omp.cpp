@@ -1,19 +1,21 @@
 #include "omp/example/include/ops_omp.hpp"
 
+#include <omp.h>
+
+#include <algorithm>
 #include <cmath>
-#include <cstddef>
 #include <vector>
 
+#include "core/util/include/thread_config.hpp"
+
 bool nesterov_a_test_task_omp::TestTaskOpenMP::PreProcessingImpl() {
   // Init value for input and output
-  unsigned int input_size = task_data->inputs_count[0];
-  auto *in_ptr = reinterpret_cast<int *>(task_data->inputs[0]);
-  input_ = std::vector<int>(in_ptr, in_ptr + input_size);
+  const auto input = task_data->GetInput<int>(0);
+  input_.assign(input.begin(), input.end());
 
-  unsigned int output_size = task_data->outputs_count[0];
-  output_ = std::vector<int>(output_size, 0);
+  output_.assign(task_data->GetOutput<int>(0).size(), 0);
 
-  rc_size_ = static_cast<int>(std::sqrt(input_size));
+  rc_size_ = static_cast<int>(std::sqrt(static_cast<double>(input.size())));
   return true;
 }
 
@@ -25,6 +27,10 @@ bool nesterov_a_test_task_omp::TestTaskOpenMP::ValidationImpl() {
 bool nesterov_a_test_task_omp::TestTaskOpenMP::RunImpl() {
 #pragma omp parallel default(none)
   {
+    // thread 0 is the caller, which keeps its binding after the region; only the team's workers are pinned
+    if (omp_get_thread_num() != 0) {
+      ppc::util::PinCurrentThread(omp_get_thread_num());
+    }
 #pragma omp critical
     {
       // Multiply matrices
@@ -42,8 +48,6 @@ bool nesterov_a_test_task_omp::TestTaskOpenMP::RunImpl() {
 }
 
 bool nesterov_a_test_task_omp::TestTaskOpenMP::PostProcessingImpl() {
-  for (size_t i = 0; i < output_.size(); i++) {
-    reinterpret_cast<int *>(task_data->outputs[0])[i] = output_[i];
-  }
+  std::ranges::copy(output_, task_data->GetOutput<int>(0).begin());
   return true;
 }
@@ -1,6 +1,12 @@
 #include <gtest/gtest.h>
+#include <omp.h>
+
+#include "core/util/include/thread_config.hpp"
 
 int main(int argc, char **argv) {
+  // Team size of parallel regions without a num_threads clause; scaling sweeps change it per point
+  omp_set_num_threads(ppc::util::GetThreadConfig().num_threads);
+
   ::testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();
 }
@@ -1,19 +1,17 @@
 #include "seq/example/include/ops_seq.hpp"
 
+#include <algorithm>
 #include <cmath>
-#include <cstddef>
 #include <vector>
 
 bool nesterov_a_test_task_seq::TestTaskSequential::PreProcessingImpl() {
   // Init value for input and output
-  unsigned int input_size = task_data->inputs_count[0];
-  auto *in_ptr = reinterpret_cast<int *>(task_data->inputs[0]);
-  input_ = std::vector<int>(in_ptr, in_ptr + input_size);
+  const auto input = task_data->GetInput<int>(0);
+  input_.assign(input.begin(), input.end());
 
-  unsigned int output_size = task_data->outputs_count[0];
-  output_ = std::vector<int>(output_size, 0);
+  output_.assign(task_data->GetOutput<int>(0).size(), 0);
 
-  rc_size_ = static_cast<int>(std::sqrt(input_size));
+  rc_size_ = static_cast<int>(std::sqrt(static_cast<double>(input.size())));
   return true;
 }
 
@@ -35,8 +33,6 @@ bool nesterov_a_test_task_seq::TestTaskSequential::RunImpl() {
 }
 
 bool nesterov_a_test_task_seq::TestTaskSequential::PostProcessingImpl() {
-  for (size_t i = 0; i < output_.size(); i++) {
-    reinterpret_cast<int *>(task_data->outputs[0])[i] = output_[i];
-  }
+  std::ranges::copy(output_, task_data->GetOutput<int>(0).begin());
   return true;
 }
@@ -8,17 +8,17 @@
 
 #include "core/perf/include/perf.hpp"
 #include "core/task/include/task.hpp"
+#include "core/util/include/data_cache.hpp"
 #include "seq/kalinin_d_odd_even_shellsort/include/header_seq_odd_even_shell.hpp"
 
 TEST(kalinin_d_odd_even_shell_seq, test_pipline_run_seq) {
   const int n = 3000000;
   // Create data
-  std::vector<int> arr(n);
+  const auto arr = ppc::util::LoadCachedRandom<int>("kalinin_d_odd_even_shellsort", n, 0, n);
   std::vector<int> out(n);
-  kalinin_d_odd_even_shell_seq::GimmeRandVec(arr);
   auto task_data_seq = std::make_shared<ppc::core::TaskData>();
-  task_data_seq->inputs.emplace_back(reinterpret_cast<uint8_t *>(arr.data()));
-  task_data_seq->inputs_count.emplace_back(arr.size());
+  task_data_seq->inputs.emplace_back(reinterpret_cast<uint8_t *>(arr.Data()));
+  task_data_seq->inputs_count.emplace_back(arr.Size());
   task_data_seq->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
   task_data_seq->outputs_count.emplace_back(out.size());
 
@@ -41,19 +41,19 @@ TEST(kalinin_d_odd_even_shell_seq, test_pipline_run_seq) {
   auto perf_analyzer = std::make_shared<ppc::core::Perf>(test_task_seq);
   perf_analyzer->PipelineRun(perf_attr, perf_results);
   ppc::core::Perf::PrintPerfStatistic(perf_results);
-  std::ranges::sort(arr.begin(), arr.end());
-  ASSERT_EQ(arr, out);
+  auto expected = arr.ToVector();
+  std::ranges::sort(expected);
+  ASSERT_EQ(expected, out);
 }
 
 TEST(kalinin_d_odd_even_shell_seq, test_task_run_seq) {
   const int n = 3000000;
   // Create data
-  std::vector<int> arr(n);
+  const auto arr = ppc::util::LoadCachedRandom<int>("kalinin_d_odd_even_shellsort", n, 0, n);
   std::vector<int> out(n);
-  kalinin_d_odd_even_shell_seq::GimmeRandVec(arr);
   auto task_data_seq = std::make_shared<ppc::core::TaskData>();
-  task_data_seq->inputs.emplace_back(reinterpret_cast<uint8_t *>(arr.data()));
-  task_data_seq->inputs_count.emplace_back(arr.size());
+  task_data_seq->inputs.emplace_back(reinterpret_cast<uint8_t *>(arr.Data()));
+  task_data_seq->inputs_count.emplace_back(arr.Size());
   task_data_seq->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
   task_data_seq->outputs_count.emplace_back(out.size());
 
@@ -77,6 +77,7 @@ TEST(kalinin_d_odd_even_shell_seq, test_task_run_seq) {
   auto perf_analyzer = std::make_shared<ppc::core::Perf>(test_task_seq);
   perf_analyzer->TaskRun(perf_attr, perf_results);
   ppc::core::Perf::PrintPerfStatistic(perf_results);
-  std::ranges::sort(arr.begin(), arr.end());
-  ASSERT_EQ(arr, out);
+  auto expected = arr.ToVector();
+  std::ranges::sort(expected);
+  ASSERT_EQ(expected, out);
 }
\ No newline at end of file
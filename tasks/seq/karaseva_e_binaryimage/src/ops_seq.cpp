@@ -107,12 +107,15 @@ bool karaseva_e_binaryimage_seq::TestTaskSequential::RunImpl() {
   LabelUnionFind label_union;
   const int dx[] = {-1, 0, -1};
   const int dy[] = {0, -1, 1};
+  // labels of the already scanned neighbors (dx/dy), cleared per pixel rather than reallocated
+  std::vector<int> neighbors;
+  neighbors.reserve(3);
 
   for (int x = 0; x < rows_; ++x) {
     for (int y = 0; y < columns_; ++y) {
       int position = (x * columns_) + y;
       if (image_[position] == 0) {
-        std::vector<int> neighbors;
+        neighbors.clear();
         ProcessNeighbors(x, y, rows_, columns_, labeled_image_, neighbors, dx, dy);
         AssignLabel(position, current_label, labeled_image_, neighbors, label_union);
       }
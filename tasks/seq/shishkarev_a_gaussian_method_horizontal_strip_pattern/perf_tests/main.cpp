@@ -3,36 +3,25 @@
 #include <chrono>
 #include <cstdint>
 #include <memory>
-#include <random>
 #include <vector>
 
 #include "core/perf/include/perf.hpp"
 #include "core/task/include/task.hpp"
+#include "core/util/include/data_cache.hpp"
 #include "seq/shishkarev_a_gaussian_method_horizontal_strip_pattern/include/ops_seq.hpp"
 
-namespace {
-std::vector<double> GetRandomMatrix(int sz) {
-  std::random_device dev;
-  std::mt19937 gen(dev());
-  std::uniform_real_distribution<double> dis(-1000, 1000);
-  std::vector<double> matrix(sz);
-  for (int i = 0; i < sz; ++i) {
-    matrix[i] = dis(gen);
-  }
-  return matrix;
-}
-}  // namespace
-
 TEST(shishkarev_a_gaussian_method_horizontal_strip_pattern_seq, test_pipeline_run) {
   constexpr int kCols = 101;
   constexpr int kRows = 100;
 
-  std::vector<double> matrix = GetRandomMatrix(kCols * kRows);
+  // seeded and cached, so every run solves the same system
+  const auto matrix = ppc::util::LoadCachedRandom<double>("shishkarev_a_gaussian_method_horizontal_strip_pattern",
+                                                          kCols * kRows, -1000, 1000);
   std::vector<double> res(kCols - 1, 0);
 
   auto task_data_seq = std::make_shared<ppc::core::TaskData>();
-  task_data_seq->inputs.emplace_back(reinterpret_cast<uint8_t *>(matrix.data()));
-  task_data_seq->inputs_count.emplace_back(matrix.size());
+  task_data_seq->inputs.emplace_back(reinterpret_cast<uint8_t *>(matrix.Data()));
+  task_data_seq->inputs_count.emplace_back(matrix.Size());
   task_data_seq->inputs_count.emplace_back(kCols);
   task_data_seq->inputs_count.emplace_back(kRows);
   task_data_seq->outputs.emplace_back(reinterpret_cast<uint8_t *>(res.data()));
@@ -61,12 +50,14 @@ TEST(shishkarev_a_gaussian_method_horizontal_strip_pattern_seq, test_task_run) {
   constexpr int kCols = 101;
   constexpr int kRows = 100;
 
-  std::vector<double> matrix = GetRandomMatrix(kCols * kRows);
+  // seeded and cached, so every run solves the same system
+  const auto matrix = ppc::util::LoadCachedRandom<double>("shishkarev_a_gaussian_method_horizontal_strip_pattern",
+                                                          kCols * kRows, -1000, 1000);
   std::vector<double> res(kCols - 1, 0);
 
   auto task_data_seq = std::make_shared<ppc::core::TaskData>();
-  task_data_seq->inputs.emplace_back(reinterpret_cast<uint8_t *>(matrix.data()));
-  task_data_seq->inputs_count.emplace_back(matrix.size());
+  task_data_seq->inputs.emplace_back(reinterpret_cast<uint8_t *>(matrix.Data()));
+  task_data_seq->inputs_count.emplace_back(matrix.Size());
   task_data_seq->inputs_count.emplace_back(kCols);
   task_data_seq->inputs_count.emplace_back(kRows);
   task_data_seq->outputs.emplace_back(reinterpret_cast<uint8_t *>(res.data()));
@@ -1,15 +1,16 @@
 #include "stl/example/include/ops_stl.hpp"
 
+#include <algorithm>
 #include <cmath>
 #include <cstddef>
-#include <thread>
 #include <vector>
 
-#include "core/util/include/util.hpp"
+#include "core/task/include/thread_pool.hpp"
 
 namespace {
-void MatMul(const std::vector<int> &in_vec, int rc_size, std::vector<int> &out_vec) {
-  for (int i = 0; i < rc_size; ++i) {
+void MatMulRows(const std::vector<int> &in_vec, int rc_size, std::size_t row_begin, std::size_t row_end,
+                std::vector<int> &out_vec) {
+  for (int i = static_cast<int>(row_begin); i < static_cast<int>(row_end); ++i) {
     for (int j = 0; j < rc_size; ++j) {
       out_vec[(i * rc_size) + j] = 0;
       for (int k = 0; k < rc_size; ++k) {
@@ -22,14 +23,12 @@ void MatMul(const std::vector<int> &in_vec, int rc_size, std::vector<int> &out_v
 
 bool nesterov_a_test_task_stl::TestTaskSTL::PreProcessingImpl() {
   // Init value for input and output
-  unsigned int input_size = task_data->inputs_count[0];
-  auto *in_ptr = reinterpret_cast<int *>(task_data->inputs[0]);
-  input_ = std::vector<int>(in_ptr, in_ptr + input_size);
+  const auto input = task_data->GetInput<int>(0);
+  input_.assign(input.begin(), input.end());
 
-  unsigned int output_size = task_data->outputs_count[0];
-  output_ = std::vector<int>(output_size, 0);
+  output_.assign(task_data->GetOutput<int>(0).size(), 0);
 
-  rc_size_ = static_cast<int>(std::sqrt(input_size));
+  rc_size_ = static_cast<int>(std::sqrt(static_cast<double>(input.size())));
   return true;
 }
 
@@ -39,18 +38,14 @@ bool nesterov_a_test_task_stl::TestTaskSTL::ValidationImpl() {
 }
 
 bool nesterov_a_test_task_stl::TestTaskSTL::RunImpl() {
-  const int num_threads = ppc::util::GetPPCNumThreads();
-  std::vector<std::thread> threads(num_threads);
-  for (int i = 0; i < num_threads; i++) {
-    threads[i] = std::thread(MatMul, std::cref(input_), rc_size_, std::ref(output_));
-    threads[i].join();
-  }
+  // the shared pool keeps its threads between runs
+  ppc::core::ThreadPool::Shared().ParallelFor(0, rc_size_, [&](std::size_t row_begin, std::size_t row_end) {
+    MatMulRows(input_, rc_size_, row_begin, row_end, output_);
+  });
   return true;
 }
 
 bool nesterov_a_test_task_stl::TestTaskSTL::PostProcessingImpl() {
-  for (size_t i = 0; i < output_.size(); i++) {
-    reinterpret_cast<int *>(task_data->outputs[0])[i] = output_[i];
-  }
+  std::ranges::copy(output_, task_data->GetOutput<int>(0).begin());
   return true;
 }
@@ -2,11 +2,11 @@
 
 #include <tbb/tbb.h>
 
+#include <algorithm>
 #include <cmath>
-#include <core/util/include/util.hpp>
-#include <cstddef>
 #include <vector>
 
+#include "core/util/include/thread_config.hpp"
 #include "oneapi/tbb/task_arena.h"
 #include "oneapi/tbb/task_group.h"
 
@@ -25,14 +25,12 @@ void MatMul(const std::vector<int> &in_vec, int rc_size, std::vector<int> &out_v
 
 bool nesterov_a_test_task_tbb::TestTaskTBB::PreProcessingImpl() {
   // Init value for input and output
-  unsigned int input_size = task_data->inputs_count[0];
-  auto *in_ptr = reinterpret_cast<int *>(task_data->inputs[0]);
-  input_ = std::vector<int>(in_ptr, in_ptr + input_size);
+  const auto input = task_data->GetInput<int>(0);
+  input_.assign(input.begin(), input.end());
 
-  unsigned int output_size = task_data->outputs_count[0];
-  output_ = std::vector<int>(output_size, 0);
+  output_.assign(task_data->GetOutput<int>(0).size(), 0);
 
-  rc_size_ = static_cast<int>(std::sqrt(input_size));
+  rc_size_ = static_cast<int>(std::sqrt(static_cast<double>(input.size())));
   return true;
 }
 
@@ -45,7 +43,7 @@ bool nesterov_a_test_task_tbb::TestTaskTBB::RunImpl() {
   oneapi::tbb::task_arena arena(1);
   arena.execute([&] {
     tbb::task_group tg;
-    for (int thr = 0; thr < ppc::util::GetPPCNumThreads(); ++thr) {
+    for (int thr = 0; thr < ppc::util::GetThreadConfig().num_threads; ++thr) {
       tg.run([&] { MatMul(input_, rc_size_, output_); });
     }
     tg.wait();
@@ -54,8 +52,6 @@ bool nesterov_a_test_task_tbb::TestTaskTBB::RunImpl() {
 }
 
 bool nesterov_a_test_task_tbb::TestTaskTBB::PostProcessingImpl() {
-  for (size_t i = 0; i < output_.size(); i++) {
-    reinterpret_cast<int *>(task_data->outputs[0])[i] = output_[i];
-  }
+  std::ranges::copy(output_, task_data->GetOutput<int>(0).begin());
   return true;
 }